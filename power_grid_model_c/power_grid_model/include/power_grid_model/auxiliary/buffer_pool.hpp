@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// allocation of aligned data buffers, with optional reuse of released buffers
+
+#include "meta_data.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace power_grid_model::meta_data {
+
+// cache of released buffers, in free lists per allocation size
+// a buffer created with a pool is given back to the pool when it is destroyed, as long as the pool is not full
+// the pool is kept alive by its buffers, the cached memory is freed when the last reference is gone
+class BufferPool {
+  public:
+    explicit BufferPool(size_t max_cached_bytes) : max_cached_bytes_{max_cached_bytes} {}
+    BufferPool(BufferPool const&) = delete;
+    BufferPool& operator=(BufferPool const&) = delete;
+    BufferPool(BufferPool&&) = delete;
+    BufferPool& operator=(BufferPool&&) = delete;
+    ~BufferPool() { clear(); }
+
+    // take a cached allocation of exactly this size, nullptr if there is none
+    void* take(size_t bytes) {
+        std::lock_guard const lock{mutex_};
+        auto const found = free_lists_.find(bytes);
+        if (found == free_lists_.end() || found->second.empty()) {
+            return nullptr;
+        }
+        void* const ptr = found->second.back();
+        found->second.pop_back();
+        cached_bytes_ -= bytes;
+        return ptr;
+    }
+
+    // cache the allocation for reuse, false if the pool is full and the caller should free it
+    bool give_back(void* ptr, size_t bytes) {
+        std::lock_guard const lock{mutex_};
+        if (cached_bytes_ + bytes > max_cached_bytes_) {
+            return false;
+        }
+        free_lists_[bytes].push_back(ptr);
+        cached_bytes_ += bytes;
+        return true;
+    }
+
+    size_t cached_bytes() const {
+        std::lock_guard const lock{mutex_};
+        return cached_bytes_;
+    }
+
+    void clear();
+
+  private:
+    mutable std::mutex mutex_;
+    size_t max_cached_bytes_;
+    size_t cached_bytes_{};
+    std::map<size_t, std::vector<void*>> free_lists_;
+};
+
+namespace detail {
+// allocations of at least this size are aligned to and advised to be backed by transparent huge pages
+constexpr size_t huge_page_size = size_t{2} << 20;
+// pooled allocations are aligned to a cache line, so that one free list serves all components
+constexpr size_t pool_alignment = 64;
+
+// every buffer is preceded by a header which tells how to release the allocation
+struct BufferHeader {
+    std::shared_ptr<BufferPool> pool;
+    size_t allocated_bytes;
+    size_t header_offset;
+};
+
+constexpr size_t round_up(size_t bytes, size_t alignment) { return ((bytes + alignment - 1) / alignment) * alignment; }
+
+// four size classes per power of two, so that pooled buffers of similar size can be reused
+// at most a quarter of the allocation is wasted
+constexpr size_t size_class_bytes(size_t bytes) {
+    if (bytes <= pool_alignment) {
+        return pool_alignment;
+    }
+    return round_up(bytes, std::bit_floor(bytes - 1) / 4);
+}
+
+inline void* aligned_allocate(size_t alignment, size_t bytes) {
+#ifdef _WIN32
+    return _aligned_malloc(bytes, alignment);
+#else
+    return std::aligned_alloc(alignment, bytes);
+#endif
+}
+
+inline void aligned_free(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc)
+#endif
+}
+
+// the advice is only a hint: the allocation is usable even if it is not honored
+inline void advise_huge_pages([[maybe_unused]] void* ptr, [[maybe_unused]] size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    (void)madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+}
+} // namespace detail
+
+inline void BufferPool::clear() {
+    std::lock_guard const lock{mutex_};
+    for (auto& [bytes, free_list] : free_lists_) {
+        std::ranges::for_each(free_list, detail::aligned_free);
+    }
+    free_lists_.clear();
+    cached_bytes_ = 0;
+}
+
+// create a buffer of bytes with at least the given alignment, nullptr if the allocation fails
+// if a pool is given, a cached allocation of the same size class is reused when available
+//    buffers with an alignment larger than a cache line are never pooled
+inline RawDataPtr create_buffer(size_t bytes, size_t alignment, std::shared_ptr<BufferPool> pool = {}) {
+    alignment = std::max(alignment, alignof(detail::BufferHeader));
+    if (alignment > detail::pool_alignment) {
+        pool.reset();
+    } else if (pool) {
+        alignment = detail::pool_alignment;
+    }
+    size_t const header_offset = detail::round_up(sizeof(detail::BufferHeader), alignment);
+    size_t allocated_bytes = header_offset + bytes;
+    if (pool) {
+        allocated_bytes = detail::size_class_bytes(allocated_bytes);
+    }
+    bool const huge = allocated_bytes >= detail::huge_page_size;
+    size_t const base_alignment = huge ? std::max(alignment, detail::huge_page_size) : alignment;
+    allocated_bytes = detail::round_up(allocated_bytes, base_alignment);
+
+    void* base = pool ? pool->take(allocated_bytes) : nullptr;
+    if (base == nullptr) {
+        base = detail::aligned_allocate(base_alignment, allocated_bytes);
+        if (base == nullptr) {
+            return nullptr;
+        }
+        if (huge) {
+            detail::advise_huge_pages(base, allocated_bytes);
+        }
+    }
+    auto* const data = static_cast<std::byte*>(base) + header_offset;
+    new (data - sizeof(detail::BufferHeader)) detail::BufferHeader{
+        .pool = std::move(pool), .allocated_bytes = allocated_bytes, .header_offset = header_offset};
+    return data;
+}
+
+// destroy a buffer created by create_buffer(), either giving it back to its pool or freeing it
+inline void destroy_buffer(RawDataPtr ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    auto* const data = static_cast<std::byte*>(ptr);
+    auto* const header = std::launder(reinterpret_cast<detail::BufferHeader*>(data - sizeof(detail::BufferHeader)));
+    auto const pool = std::move(header->pool);
+    size_t const allocated_bytes = header->allocated_bytes;
+    void* const base = data - header->header_offset;
+    header->~BufferHeader();
+    if (!pool || !pool->give_back(base, allocated_bytes)) {
+        detail::aligned_free(base);
+    }
+}
+
+} // namespace power_grid_model::meta_data
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// convert datasets between row-based and columnar layouts
+
+#include "dataset.hpp"
+#include "meta_data.hpp"
+
+#include "../common/common.hpp"
+#include "../common/exception.hpp"
+#include "../common/threading.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <vector>
+
+namespace power_grid_model::meta_data {
+
+namespace detail {
+
+// number of elements converted in one task
+// the rows of a block stay in cache while all attributes of the block are copied
+constexpr Idx conversion_block_size = 4096;
+
+struct ConversionBlock {
+    Idx component_idx{};
+    Idx begin{};
+    Idx size{};
+};
+
+template <dataset_type_tag source_type, dataset_type_tag target_type>
+void check_conversion_compatible(Dataset<source_type> const& source, Dataset<target_type> const& target) {
+    if (std::string_view{source.dataset().name} != target.dataset().name) {
+        throw DatasetError{std::format("Cannot convert a '{}' dataset into a '{}' dataset!\n", source.dataset().name,
+                                       target.dataset().name)};
+    }
+    if (source.is_batch() != target.is_batch() || source.batch_size() != target.batch_size()) {
+        throw DatasetError{"Cannot convert between datasets with different batch sizes!\n"};
+    }
+    if (source.n_components() != target.n_components()) {
+        throw DatasetError{"Cannot convert between datasets with different components!\n"};
+    }
+    for (Idx source_idx = 0; source_idx != source.n_components(); ++source_idx) {
+        ComponentInfo const& source_info = source.get_component_info(source_idx);
+        Idx const target_idx = target.find_component(source_info.component->name, true);
+        ComponentInfo const& target_info = target.get_component_info(target_idx);
+        if (source_info.elements_per_scenario != target_info.elements_per_scenario ||
+            source_info.total_elements != target_info.total_elements) {
+            throw DatasetError{std::format("Cannot convert component '{}' between different numbers of elements!\n",
+                                           source_info.component->name)};
+        }
+        auto const& source_indptr = source.get_buffer(source_idx).indptr;
+        auto const& target_indptr = target.get_buffer(target_idx).indptr;
+        if (!std::ranges::equal(source_indptr, target_indptr)) {
+            throw DatasetError{std::format("Cannot convert component '{}' between different indptr!\n",
+                                           source_info.component->name)};
+        }
+        // a columnar component without attribute buffers has no data to convert from or to
+        bool const source_has_data = source.is_row_based(source_idx) || source.is_columnar(source_idx, true);
+        bool const target_has_data = target.is_row_based(target_idx) || target.is_columnar(target_idx, true);
+        if (source_info.total_elements > 0 && (!source_has_data || !target_has_data)) {
+            throw DatasetError{
+                std::format("Cannot convert component '{}' without a buffer!\n", source_info.component->name)};
+        }
+    }
+}
+
+template <class Data> AttributeBuffer<Data> const* find_attribute_buffer(std::span<AttributeBuffer<Data> const> buffers,
+                                                                          MetaAttribute const* meta_attribute) {
+    auto const found = std::ranges::find(buffers, meta_attribute, &AttributeBuffer<Data>::meta_attribute);
+    return found == buffers.end() ? nullptr : &*found;
+}
+
+inline void set_nan_attribute_range(MetaAttribute const& meta_attribute, RawDataPtr data, Idx begin, Idx size) {
+    ctype_func_selector(meta_attribute.ctype, [data, begin, size]<class T> {
+        T* const ptr = reinterpret_cast<T*>(data) + begin;
+        std::fill(ptr, ptr + size, nan_value<T>);
+    });
+}
+
+// convert elements [begin, begin + size) of one component
+template <class SourceBuffer, class TargetBuffer>
+void convert_block(MetaComponent const& component, SourceBuffer const& source, TargetBuffer const& target, Idx begin,
+                   Idx size) {
+    bool const source_row_based = source.data != nullptr;
+    bool const target_row_based = target.data != nullptr;
+
+    if (source_row_based && target_row_based) {
+        std::memcpy(component.advance_ptr(target.data, begin), component.advance_ptr(source.data, begin),
+                    component.size * size);
+    } else if (source_row_based) {
+        // row-based to columnar: gather every attribute
+        for (auto const& attribute_buffer : target.attributes) {
+            auto const& meta_attribute = *attribute_buffer.meta_attribute;
+            meta_attribute.get_values(source.data, attribute_buffer.data, begin, size,
+                                      static_cast<Idx>(meta_attribute.size));
+        }
+    } else if (target_row_based) {
+        // columnar to row-based: attributes without source buffer stay nan
+        component.set_nan(target.data, begin, size);
+        for (auto const& attribute_buffer : source.attributes) {
+            auto const& meta_attribute = *attribute_buffer.meta_attribute;
+            meta_attribute.set_values(target.data, attribute_buffer.data, begin, size,
+                                      static_cast<Idx>(meta_attribute.size));
+        }
+    } else {
+        // columnar to columnar: copy the matching attributes, the others are nan
+        for (auto const& attribute_buffer : target.attributes) {
+            auto const& meta_attribute = *attribute_buffer.meta_attribute;
+            auto const* source_attribute_buffer =
+                find_attribute_buffer(std::span{source.attributes}, attribute_buffer.meta_attribute);
+            if (source_attribute_buffer == nullptr) {
+                set_nan_attribute_range(meta_attribute, attribute_buffer.data, begin, size);
+                continue;
+            }
+            std::memcpy(reinterpret_cast<char*>(attribute_buffer.data) + begin * meta_attribute.size,
+                        reinterpret_cast<char const*>(source_attribute_buffer->data) + begin * meta_attribute.size,
+                        meta_attribute.size * size);
+        }
+    }
+}
+
+} // namespace detail
+
+// convert all components and scenarios of the source dataset into the buffers of the target dataset
+// the target should have the same components with the same number of elements (and indptr) as the source
+//    every component can be row-based or columnar in either dataset, independent of each other
+//    attributes of the target that are not present in the source are set to nan
+// the elements are converted in blocks, which are distributed over the threads (see common/threading.hpp)
+template <dataset_type_tag source_type, dataset_type_tag target_type>
+    requires is_data_mutable_v<target_type>
+void convert_dataset(Dataset<source_type> const& source, Dataset<target_type> const& target, Idx threading = -1) {
+    detail::check_conversion_compatible(source, target);
+
+    std::vector<detail::ConversionBlock> blocks;
+    for (Idx component_idx = 0; component_idx != source.n_components(); ++component_idx) {
+        Idx const total_elements = source.get_component_info(component_idx).total_elements;
+        for (Idx begin = 0; begin < total_elements; begin += detail::conversion_block_size) {
+            blocks.push_back({.component_idx = component_idx,
+                              .begin = begin,
+                              .size = std::min(detail::conversion_block_size, total_elements - begin)});
+        }
+    }
+
+    auto const convert_blocks = [&source, &target, &blocks](Idx start, Idx stride) {
+        for (Idx block_idx = start; block_idx < static_cast<Idx>(blocks.size()); block_idx += stride) {
+            auto const& block = blocks[block_idx];
+            MetaComponent const& component = *source.get_component_info(block.component_idx).component;
+            detail::convert_block(component, source.get_buffer(block.component_idx),
+                                  target.get_buffer(component.name), block.begin, block.size);
+        }
+    };
+
+    Idx const n_thread = get_n_threads(threading, static_cast<Idx>(blocks.size()));
+    run_in_threads(n_thread, [&convert_blocks, n_thread](Idx thread_number) { convert_blocks(thread_number, n_thread); });
+}
+
+} // namespace power_grid_model::meta_data
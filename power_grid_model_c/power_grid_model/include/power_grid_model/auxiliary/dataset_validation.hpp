@@ -0,0 +1,615 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// validate the data of an input dataset before the construction of a model
+
+#include "dataset.hpp"
+#include "meta_data.hpp"
+
+#include "../common/common.hpp"
+#include "../common/enum.hpp"
+#include "../common/exception.hpp"
+#include "../common/three_phase_tensor.hpp"
+#include "../common/threading.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace power_grid_model::meta_data {
+
+// all elements of a component which fail the same check of an attribute
+// the elements are the sorted positions in the buffer of the component, over all scenarios
+struct ValidationError {
+    ValidationErrorType error_type{};
+    MetaComponent const* component{};
+    MetaAttribute const* attribute{};
+    std::vector<Idx> elements;
+};
+
+struct ValidationResult {
+    std::vector<ValidationError> errors;
+};
+
+namespace validation {
+
+// number of elements checked in one task
+// the values of a block are gathered once and stay in cache while they are checked
+constexpr Idx block_size = 4096;
+
+constexpr double inf = std::numeric_limits<double>::infinity();
+
+// an empty component name means that the rule applies to every component with the attribute
+struct RequiredRule {
+    std::string_view component;
+    std::string_view attribute;
+};
+
+// nan values are not out of range, they are only rejected for required attributes
+struct RangeRule {
+    std::string_view component;
+    std::string_view attribute;
+    double lower{-inf};
+    double upper{inf};
+    bool lower_inclusive{false};
+    bool upper_inclusive{false};
+
+    constexpr bool contains(double value) const {
+        return (lower_inclusive ? value >= lower : value > lower) && (upper_inclusive ? value <= upper : value < upper);
+    }
+};
+
+// an id should exist in one of the referenced components, any component if there are none
+struct ReferenceRule {
+    std::string_view component;
+    std::string_view attribute;
+    std::span<std::string_view const> referenced_components;
+};
+
+constexpr RangeRule greater_than_zero(std::string_view component, std::string_view attribute) {
+    return {.component = component, .attribute = attribute, .lower = 0.0};
+}
+constexpr RangeRule greater_than_or_equal_to_zero(std::string_view component, std::string_view attribute) {
+    return {.component = component, .attribute = attribute, .lower = 0.0, .lower_inclusive = true};
+}
+constexpr RangeRule less_than(std::string_view component, std::string_view attribute, double upper) {
+    return {.component = component, .attribute = attribute, .upper = upper};
+}
+constexpr RangeRule between(std::string_view component, std::string_view attribute, double lower, double upper) {
+    return {.component = component, .attribute = attribute, .lower = lower, .upper = upper};
+}
+constexpr RangeRule between_or_at(std::string_view component, std::string_view attribute, double lower,
+                                  double upper) {
+    return {.component = component,
+            .attribute = attribute,
+            .lower = lower,
+            .upper = upper,
+            .lower_inclusive = true,
+            .upper_inclusive = true};
+}
+constexpr RangeRule boolean(std::string_view attribute) { return between_or_at({}, attribute, 0.0, 1.0); }
+
+// the attributes which are needed by every calculation type
+constexpr auto required_rules = std::to_array<RequiredRule>({
+    {{}, "id"},
+    {{}, "from_node"},
+    {{}, "to_node"},
+    {{}, "from_status"},
+    {{}, "to_status"},
+    {{}, "node_1"},
+    {{}, "node_2"},
+    {{}, "node_3"},
+    {{}, "status_1"},
+    {{}, "status_2"},
+    {{}, "status_3"},
+    {{}, "node"},
+    {{}, "measured_object"},
+    {{}, "regulated_object"},
+    {{}, "fault_object"},
+    {"node", "u_rated"},
+    {"line", "r1"},
+    {"line", "x1"},
+    {"line", "c1"},
+    {"line", "tan1"},
+    {"asym_line", "r_aa"},
+    {"asym_line", "r_ba"},
+    {"asym_line", "r_bb"},
+    {"asym_line", "r_ca"},
+    {"asym_line", "r_cb"},
+    {"asym_line", "r_cc"},
+    {"asym_line", "x_aa"},
+    {"asym_line", "x_ba"},
+    {"asym_line", "x_bb"},
+    {"asym_line", "x_ca"},
+    {"asym_line", "x_cb"},
+    {"asym_line", "x_cc"},
+    {"transformer", "u1"},
+    {"transformer", "u2"},
+    {"transformer", "sn"},
+    {"transformer", "uk"},
+    {"transformer", "pk"},
+    {"transformer", "i0"},
+    {"transformer", "p0"},
+    {"transformer", "winding_from"},
+    {"transformer", "winding_to"},
+    {"transformer", "clock"},
+    {"transformer", "tap_side"},
+    {"transformer", "tap_min"},
+    {"transformer", "tap_max"},
+    {"transformer", "tap_size"},
+    {"three_winding_transformer", "u1"},
+    {"three_winding_transformer", "u2"},
+    {"three_winding_transformer", "u3"},
+    {"three_winding_transformer", "sn_1"},
+    {"three_winding_transformer", "sn_2"},
+    {"three_winding_transformer", "sn_3"},
+    {"three_winding_transformer", "uk_12"},
+    {"three_winding_transformer", "uk_13"},
+    {"three_winding_transformer", "uk_23"},
+    {"three_winding_transformer", "pk_12"},
+    {"three_winding_transformer", "pk_13"},
+    {"three_winding_transformer", "pk_23"},
+    {"three_winding_transformer", "i0"},
+    {"three_winding_transformer", "p0"},
+    {"three_winding_transformer", "winding_1"},
+    {"three_winding_transformer", "winding_2"},
+    {"three_winding_transformer", "winding_3"},
+    {"three_winding_transformer", "clock_12"},
+    {"three_winding_transformer", "clock_13"},
+    {"three_winding_transformer", "tap_side"},
+    {"three_winding_transformer", "tap_min"},
+    {"three_winding_transformer", "tap_max"},
+    {"three_winding_transformer", "tap_size"},
+    {"transformer_tap_regulator", "status"},
+    {"source", "status"},
+    {"shunt", "status"},
+    {"shunt", "g1"},
+    {"shunt", "b1"},
+    {"sym_load", "status"},
+    {"sym_load", "type"},
+    {"asym_load", "status"},
+    {"asym_load", "type"},
+    {"sym_gen", "status"},
+    {"sym_gen", "type"},
+    {"asym_gen", "status"},
+    {"asym_gen", "type"},
+    {"sym_power_sensor", "measured_terminal_type"},
+    {"asym_power_sensor", "measured_terminal_type"},
+});
+
+constexpr auto range_rules = std::to_array<RangeRule>({
+    boolean("from_status"),
+    boolean("to_status"),
+    boolean("status_1"),
+    boolean("status_2"),
+    boolean("status_3"),
+    boolean("status"),
+    greater_than_zero("node", "u_rated"),
+    greater_than_zero("line", "i_n"),
+    greater_than_zero("asym_line", "i_n"),
+    greater_than_zero("generic_branch", "k"),
+    greater_than_or_equal_to_zero("generic_branch", "sn"),
+    greater_than_zero("transformer", "u1"),
+    greater_than_zero("transformer", "u2"),
+    greater_than_zero("transformer", "sn"),
+    between("transformer", "uk", 0.0, 1.0),
+    greater_than_or_equal_to_zero("transformer", "pk"),
+    less_than("transformer", "i0", 1.0),
+    greater_than_or_equal_to_zero("transformer", "p0"),
+    between_or_at("transformer", "clock", 0.0, 12.0),
+    greater_than_or_equal_to_zero("transformer", "tap_size"),
+    greater_than_zero("three_winding_transformer", "u1"),
+    greater_than_zero("three_winding_transformer", "u2"),
+    greater_than_zero("three_winding_transformer", "u3"),
+    greater_than_zero("three_winding_transformer", "sn_1"),
+    greater_than_zero("three_winding_transformer", "sn_2"),
+    greater_than_zero("three_winding_transformer", "sn_3"),
+    between("three_winding_transformer", "uk_12", 0.0, 1.0),
+    between("three_winding_transformer", "uk_13", 0.0, 1.0),
+    between("three_winding_transformer", "uk_23", 0.0, 1.0),
+    greater_than_or_equal_to_zero("three_winding_transformer", "pk_12"),
+    greater_than_or_equal_to_zero("three_winding_transformer", "pk_13"),
+    greater_than_or_equal_to_zero("three_winding_transformer", "pk_23"),
+    less_than("three_winding_transformer", "i0", 1.0),
+    greater_than_or_equal_to_zero("three_winding_transformer", "p0"),
+    between_or_at("three_winding_transformer", "clock_12", 0.0, 12.0),
+    between_or_at("three_winding_transformer", "clock_13", 0.0, 12.0),
+    greater_than_or_equal_to_zero("three_winding_transformer", "tap_size"),
+    greater_than_zero("source", "u_ref"),
+    greater_than_zero("source", "sk"),
+    greater_than_or_equal_to_zero("source", "rx_ratio"),
+    greater_than_zero("source", "z01_ratio"),
+    greater_than_zero("sym_voltage_sensor", "u_sigma"),
+    greater_than_zero("sym_voltage_sensor", "u_measured"),
+    greater_than_zero("asym_voltage_sensor", "u_sigma"),
+    greater_than_zero("asym_voltage_sensor", "u_measured"),
+    greater_than_zero("sym_power_sensor", "power_sigma"),
+    greater_than_zero("asym_power_sensor", "power_sigma"),
+    greater_than_or_equal_to_zero("fault", "r_f"),
+    greater_than_or_equal_to_zero("transformer_tap_regulator", "u_set"),
+    greater_than_zero("transformer_tap_regulator", "u_band"),
+});
+
+constexpr auto node_components = std::to_array<std::string_view>({"node"});
+constexpr auto regulated_components = std::to_array<std::string_view>({"transformer", "three_winding_transformer"});
+
+// the first matching rule applies, so the component specific rules come before the general ones
+constexpr auto reference_rules = std::to_array<ReferenceRule>({
+    {{}, "node", node_components},
+    {{}, "from_node", node_components},
+    {{}, "to_node", node_components},
+    {{}, "node_1", node_components},
+    {{}, "node_2", node_components},
+    {{}, "node_3", node_components},
+    {"sym_voltage_sensor", "measured_object", node_components},
+    {"asym_voltage_sensor", "measured_object", node_components},
+    {{}, "measured_object", {}},
+    {"fault", "fault_object", node_components},
+    {"transformer_tap_regulator", "regulated_object", regulated_components},
+});
+
+template <class Rule>
+bool rule_matches(Rule const& rule, MetaComponent const& component, MetaAttribute const& attribute) {
+    return (rule.component.empty() || rule.component == component.name) && rule.attribute == attribute.name;
+}
+
+template <class Rule, size_t n>
+Rule const* find_rule(std::array<Rule, n> const& rules, MetaComponent const& component,
+                      MetaAttribute const& attribute) {
+    auto const found =
+        std::ranges::find_if(rules, [&](Rule const& rule) { return rule_matches(rule, component, attribute); });
+    return found == rules.end() ? nullptr : &*found;
+}
+
+struct Check {
+    ValidationErrorType error_type{};
+    Idx component_idx{};
+    MetaAttribute const* attribute{};
+    RangeRule const* range{};
+    // whether an id of each component of the dataset may be referenced
+    std::vector<char> referenced_components{};
+};
+
+struct IdEntry {
+    ID id{};
+    Idx component_idx{};
+    Idx position{};
+};
+
+struct ValidationBlock {
+    Idx component_idx{};
+    Idx scenario{};
+    Idx begin{};
+    Idx size{};
+};
+
+// the failed elements of every check and the buffers of one thread
+struct WorkerState {
+    std::vector<std::vector<Idx>> failures;
+    // double elements keep the gathered values of every ctype aligned
+    std::vector<double> scratch{};
+    std::vector<uint8_t> mask{};
+};
+
+// run the tasks [0, n_tasks), each thread handles every n_thread-th task with its own worker state
+template <class Task> void run_tasks(std::span<WorkerState> states, Idx n_tasks, Task const& task) {
+    auto const n_thread = static_cast<Idx>(states.size());
+    run_in_threads(n_thread, [&states, &task, n_tasks, n_thread](Idx thread_number) {
+        for (Idx task_idx = thread_number; task_idx < n_tasks; task_idx += n_thread) {
+            task(states[thread_number], task_idx);
+        }
+    });
+}
+
+inline std::pair<Idx, Idx> scenario_range(ConstDataset const& dataset, Idx component_idx, Idx scenario) {
+    auto const& indptr = dataset.get_buffer(component_idx).indptr;
+    if (indptr.empty()) {
+        Idx const elements_per_scenario = dataset.get_component_info(component_idx).elements_per_scenario;
+        return {scenario * elements_per_scenario, (scenario + 1) * elements_per_scenario};
+    }
+    return {indptr[scenario], indptr[scenario + 1]};
+}
+
+// the values of an attribute for the elements [begin, begin + size) as a contiguous array
+// columnar buffers are read in place, the values of row-based buffers are gathered into the scratch buffer
+// the span is empty if a columnar buffer has no values for the attribute
+template <class T>
+std::span<T const> attribute_values(ConstDataset::Buffer const& buffer, MetaComponent const& component,
+                                    MetaAttribute const& attribute, Idx begin, Idx size, std::vector<double>& scratch) {
+    if (buffer.data != nullptr) {
+        scratch.resize((sizeof(T) * size + sizeof(double) - 1) / sizeof(double));
+        attribute.get_values(component.advance_ptr(buffer.data, begin), scratch.data(), 0, size,
+                             static_cast<Idx>(sizeof(T)));
+        return {reinterpret_cast<T const*>(scratch.data()), static_cast<size_t>(size)};
+    }
+    auto const found = std::ranges::find(buffer.attributes, &attribute, &AttributeBuffer<void const>::meta_attribute);
+    if (found == buffer.attributes.end()) {
+        return {};
+    }
+    return {reinterpret_cast<T const*>(found->data) + begin, static_cast<size_t>(size)};
+}
+
+template <class T> bool has_nan(T const& value) {
+    if constexpr (std::same_as<T, RealValue<asymmetric_t>>) {
+        return is_nan(value(0)) || is_nan(value(1)) || is_nan(value(2));
+    } else {
+        return is_nan(value);
+    }
+}
+
+template <class T> bool is_out_of_range(T const& value, RangeRule const& rule) {
+    if constexpr (std::same_as<T, RealValue<asymmetric_t>>) {
+        return is_out_of_range(value(0), rule) || is_out_of_range(value(1), rule) || is_out_of_range(value(2), rule);
+    } else {
+        return !is_nan(value) && !rule.contains(static_cast<double>(value));
+    }
+}
+
+// the predicate is first evaluated for the whole block in a loop without branches, which the compiler can vectorize
+// the failed elements are only collected if there are any
+template <class T, class Predicate>
+void collect_failures(std::span<T const> values, Idx begin, Predicate const& predicate, std::vector<uint8_t>& mask,
+                      std::vector<Idx>& failures) {
+    mask.resize(values.size());
+    uint8_t any_failed{0};
+    for (size_t i = 0; i != values.size(); ++i) {
+        auto const failed = static_cast<uint8_t>(predicate(values[i]));
+        mask[i] = failed;
+        any_failed |= failed;
+    }
+    if (any_failed == 0) {
+        return;
+    }
+    for (size_t i = 0; i != values.size(); ++i) {
+        if (mask[i] != 0) {
+            failures.push_back(begin + static_cast<Idx>(i));
+        }
+    }
+}
+
+inline bool is_referenced(std::span<IdEntry const> ids, ID id, std::vector<char> const& referenced_components) {
+    auto const [first, last] = std::ranges::equal_range(ids, id, {}, &IdEntry::id);
+    return std::any_of(first, last,
+                       [&referenced_components](IdEntry const& entry) {
+                           return referenced_components[entry.component_idx] != 0;
+                       });
+}
+
+inline void check_block(ConstDataset const& dataset, Check const& check, std::span<IdEntry const> ids,
+                        ValidationBlock const& block, WorkerState& state, std::vector<Idx>& failures) {
+    MetaComponent const& component = *dataset.get_component_info(block.component_idx).component;
+    auto const& buffer = dataset.get_buffer(block.component_idx);
+    MetaAttribute const& attribute = *check.attribute;
+
+    ctype_func_selector(attribute.ctype, [&]<class T> {
+        auto const values = attribute_values<T>(buffer, component, attribute, block.begin, block.size, state.scratch);
+        if (values.empty()) {
+            // an attribute without values is missing for every element
+            if (check.error_type == ValidationErrorType::missing_value) {
+                for (Idx i = 0; i != block.size; ++i) {
+                    failures.push_back(block.begin + i);
+                }
+            }
+            return;
+        }
+        switch (check.error_type) {
+            using enum ValidationErrorType;
+        case missing_value:
+            collect_failures(values, block.begin, [](T const& value) { return has_nan(value); }, state.mask,
+                             failures);
+            return;
+        case out_of_range:
+            collect_failures(
+                values, block.begin, [&range = *check.range](T const& value) { return is_out_of_range(value, range); },
+                state.mask, failures);
+            return;
+        case invalid_reference:
+            if constexpr (std::same_as<T, ID>) {
+                for (Idx i = 0; i != block.size; ++i) {
+                    ID const value = values[i];
+                    if (!is_nan(value) && !is_referenced(ids, value, check.referenced_components)) {
+                        failures.push_back(block.begin + i);
+                    }
+                }
+            }
+            return;
+        default:
+            return;
+        }
+    });
+}
+
+inline std::vector<Check> create_checks(ConstDataset const& dataset) {
+    std::vector<Check> checks;
+    for (Idx component_idx = 0; component_idx != dataset.n_components(); ++component_idx) {
+        MetaComponent const& component = *dataset.get_component_info(component_idx).component;
+        for (MetaAttribute const& attribute : component.attributes) {
+            Check const base{.component_idx = component_idx, .attribute = &attribute};
+            if (std::string_view{attribute.name} == "id") {
+                checks.push_back(base);
+                checks.back().error_type = ValidationErrorType::not_unique;
+            }
+            if (find_rule(required_rules, component, attribute) != nullptr) {
+                checks.push_back(base);
+                checks.back().error_type = ValidationErrorType::missing_value;
+            }
+            if (auto const* range = find_rule(range_rules, component, attribute); range != nullptr) {
+                checks.push_back(base);
+                checks.back().error_type = ValidationErrorType::out_of_range;
+                checks.back().range = range;
+            }
+            if (auto const* reference = find_rule(reference_rules, component, attribute);
+                reference != nullptr && attribute.ctype == CType::c_int32) {
+                checks.push_back(base);
+                checks.back().error_type = ValidationErrorType::invalid_reference;
+                checks.back().referenced_components.resize(dataset.n_components(),
+                                                           reference->referenced_components.empty() ? 1 : 0);
+                for (std::string_view const referenced : reference->referenced_components) {
+                    if (Idx const idx = dataset.find_component(referenced); idx != ConstDataset::invalid_index) {
+                        checks.back().referenced_components[idx] = 1;
+                    }
+                }
+            }
+        }
+    }
+    return checks;
+}
+
+} // namespace validation
+
+// validate all components and scenarios of an input dataset, every scenario is validated on its own
+//    every component can be row-based or columnar
+//    the ids should be unique over all components
+//    the ids of references should exist, in the components which can be referenced
+//    the attributes which are needed by every calculation type should not be nan
+//    the values should be within the valid range, nan values are not checked
+// the elements are validated in blocks, which are distributed over the threads (see common/threading.hpp)
+inline ValidationResult validate_dataset(ConstDataset const& dataset, Idx threading = -1) {
+    using namespace validation;
+
+    if (std::string_view{dataset.dataset().name} != "input") {
+        throw DatasetError{"Only input datasets can be validated!\n"};
+    }
+
+    std::vector<Check> const checks = create_checks(dataset);
+    std::vector<std::vector<Idx>> component_checks(dataset.n_components());
+    std::vector<MetaAttribute const*> id_attributes(dataset.n_components());
+    std::vector<Idx> id_checks(dataset.n_components(), -1);
+    for (Idx check_idx = 0; check_idx != static_cast<Idx>(checks.size()); ++check_idx) {
+        Check const& check = checks[check_idx];
+        if (check.error_type == ValidationErrorType::not_unique) {
+            id_attributes[check.component_idx] = check.attribute;
+            id_checks[check.component_idx] = check_idx;
+        } else {
+            component_checks[check.component_idx].push_back(check_idx);
+        }
+    }
+
+    Idx const batch_size = dataset.batch_size();
+    Idx const n_components = dataset.n_components();
+
+    // the ids of every scenario, in a slice per component
+    std::vector<std::vector<IdEntry>> scenario_ids(batch_size);
+    std::vector<std::vector<Idx>> slice_offsets(batch_size, std::vector<Idx>(n_components + 1, 0));
+    for (Idx scenario = 0; scenario != batch_size; ++scenario) {
+        auto& offsets = slice_offsets[scenario];
+        for (Idx component_idx = 0; component_idx != n_components; ++component_idx) {
+            auto const [begin, end] = scenario_range(dataset, component_idx, scenario);
+            Idx const n_ids = id_attributes[component_idx] != nullptr ? end - begin : 0;
+            offsets[component_idx + 1] = offsets[component_idx] + n_ids;
+        }
+        scenario_ids[scenario].resize(offsets.back());
+    }
+
+    auto const new_states = [&checks](Idx n_thread) {
+        std::vector<WorkerState> states(n_thread);
+        for (auto& state : states) {
+            state.failures.resize(checks.size());
+        }
+        return states;
+    };
+
+    // gather and sort the ids of every component in every scenario
+    Idx const n_slices = batch_size * n_components;
+    auto slice_states = new_states(get_n_threads(threading, n_slices));
+    run_tasks(slice_states, n_slices, [&](WorkerState& state, Idx task_idx) {
+        Idx const scenario = task_idx / n_components;
+        Idx const component_idx = task_idx % n_components;
+        MetaAttribute const* const id_attribute = id_attributes[component_idx];
+        if (id_attribute == nullptr) {
+            return;
+        }
+        auto const [begin, end] = scenario_range(dataset, component_idx, scenario);
+        auto const slice = std::span{scenario_ids[scenario]}.subspan(slice_offsets[scenario][component_idx],
+                                                                      static_cast<size_t>(end - begin));
+        for (Idx block_begin = begin; block_begin < end; block_begin += block_size) {
+            Idx const size = std::min(block_size, end - block_begin);
+            auto const ids = attribute_values<ID>(dataset.get_buffer(component_idx),
+                                                  *dataset.get_component_info(component_idx).component,
+                                                  *id_attribute, block_begin, size, state.scratch);
+            for (Idx i = 0; i != size; ++i) {
+                slice[block_begin - begin + i] = {.id = ids.empty() ? na_IntID : ids[i],
+                                                  .component_idx = component_idx,
+                                                  .position = block_begin + i};
+            }
+        }
+        std::ranges::sort(slice, {}, &IdEntry::id);
+    });
+
+    // merge the sorted slices of every scenario and find the duplicate ids
+    auto scenario_states = new_states(get_n_threads(threading, batch_size));
+    run_tasks(scenario_states, batch_size, [&](WorkerState& state, Idx scenario) {
+        auto& ids = scenario_ids[scenario];
+        auto const& offsets = slice_offsets[scenario];
+        for (Idx component_idx = 1; component_idx < n_components; ++component_idx) {
+            std::inplace_merge(ids.begin(), ids.begin() + offsets[component_idx],
+                               ids.begin() + offsets[component_idx + 1],
+                               [](IdEntry const& x, IdEntry const& y) { return x.id < y.id; });
+        }
+        for (auto first = ids.begin(); first != ids.end();) {
+            auto const last = std::find_if(first, ids.end(), [id = first->id](IdEntry const& x) { return x.id != id; });
+            if (last - first > 1 && !is_nan(first->id)) {
+                for (auto it = first; it != last; ++it) {
+                    state.failures[id_checks[it->component_idx]].push_back(it->position);
+                }
+            }
+            first = last;
+        }
+    });
+
+    // check the attributes of all elements
+    std::vector<ValidationBlock> blocks;
+    for (Idx component_idx = 0; component_idx != n_components; ++component_idx) {
+        if (component_checks[component_idx].empty()) {
+            continue;
+        }
+        for (Idx scenario = 0; scenario != batch_size; ++scenario) {
+            auto const [begin, end] = scenario_range(dataset, component_idx, scenario);
+            for (Idx block_begin = begin; block_begin < end; block_begin += block_size) {
+                blocks.push_back({.component_idx = component_idx,
+                                  .scenario = scenario,
+                                  .begin = block_begin,
+                                  .size = std::min(block_size, end - block_begin)});
+            }
+        }
+    }
+    auto const n_blocks = static_cast<Idx>(blocks.size());
+    auto block_states = new_states(get_n_threads(threading, n_blocks));
+    run_tasks(block_states, n_blocks, [&](WorkerState& state, Idx block_idx) {
+        ValidationBlock const& block = blocks[block_idx];
+        for (Idx const check_idx : component_checks[block.component_idx]) {
+            check_block(dataset, checks[check_idx], scenario_ids[block.scenario], block, state,
+                        state.failures[check_idx]);
+        }
+    });
+
+    // one error per failed check, with the elements of all threads
+    ValidationResult result;
+    for (Idx check_idx = 0; check_idx != static_cast<Idx>(checks.size()); ++check_idx) {
+        std::vector<Idx> elements;
+        for (auto const* states : {&slice_states, &scenario_states, &block_states}) {
+            for (auto const& state : *states) {
+                elements.insert(elements.end(), state.failures[check_idx].begin(), state.failures[check_idx].end());
+            }
+        }
+        if (elements.empty()) {
+            continue;
+        }
+        std::ranges::sort(elements);
+        Check const& check = checks[check_idx];
+        result.errors.push_back({.error_type = check.error_type,
+                                 .component = dataset.get_component_info(check.component_idx).component,
+                                 .attribute = check.attribute,
+                                 .elements = std::move(elements)});
+    }
+    return result;
+}
+
+} // namespace power_grid_model::meta_data
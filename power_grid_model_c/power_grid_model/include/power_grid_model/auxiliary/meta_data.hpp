@@ -8,11 +8,15 @@
 #include "../common/enum.hpp"
 #include "../common/exception.hpp"
 #include "../common/three_phase_tensor.hpp"
+#include "../common/threading.hpp"
 
+#include <algorithm>
 #include <bit>
+#include <cstring>
 #include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace power_grid_model::meta_data {
 
@@ -85,6 +89,34 @@ inline T const nan_value = [] {
 using RawDataPtr = void*;            // raw mutable data ptr
 using RawDataConstPtr = void const*; // raw read-only data ptr
 
+// block size in bytes of the pattern fill, small enough to stay in the L1 cache
+constexpr size_t pattern_fill_block_bytes = 4096;
+// minimum number of bytes set to nan by one thread in a parallel set nan
+constexpr size_t set_nan_bytes_per_thread = size_t{4} << 20;
+
+// fill size elements of element_size bytes with the bytes of the pattern element
+// the pattern is doubled within the first block, the block then stays in cache while it is copied to the rest
+inline void fill_with_pattern(RawDataPtr ptr, RawDataConstPtr pattern, size_t element_size, Idx size) {
+    if (size <= 0) {
+        return;
+    }
+    auto* const begin = reinterpret_cast<char*>(ptr);
+    size_t const total_bytes = element_size * static_cast<size_t>(size);
+    size_t const block_bytes =
+        std::min(total_bytes, std::max(element_size, pattern_fill_block_bytes / element_size * element_size));
+    std::memcpy(begin, pattern, element_size);
+    for (size_t filled = element_size; filled < block_bytes;) {
+        size_t const n_bytes = std::min(filled, block_bytes - filled);
+        std::memcpy(begin + filled, begin, n_bytes);
+        filled += n_bytes;
+    }
+    for (size_t filled = block_bytes; filled < total_bytes;) {
+        size_t const n_bytes = std::min(block_bytes, total_bytes - filled);
+        std::memcpy(begin + filled, begin, n_bytes);
+        filled += n_bytes;
+    }
+}
+
 // meta attribute
 struct MetaAttribute {
     // meta data
@@ -99,6 +131,10 @@ struct MetaAttribute {
     std::add_pointer_t<bool(RawDataConstPtr, Idx)> check_all_nan{};
     std::add_pointer_t<void(RawDataPtr, RawDataConstPtr, Idx)> set_value{};
     std::add_pointer_t<void(RawDataConstPtr, RawDataPtr, Idx)> get_value{};
+    // bulk variants for the elements [pos, pos + size) of the buffer
+    // the value of element i is at (char const*)value_ptr + i * stride, a zero stride broadcasts a single value
+    std::add_pointer_t<void(RawDataPtr, RawDataConstPtr, Idx, Idx, Idx)> set_values{};
+    std::add_pointer_t<void(RawDataConstPtr, RawDataPtr, Idx, Idx, Idx)> get_values{};
     std::add_pointer_t<bool(RawDataConstPtr, RawDataConstPtr, double, double, Idx)> compare_value{};
 
     // get attribute by offsetting the pointer
@@ -143,6 +179,19 @@ struct MetaComponent {
 
     bool has_attribute(std::string_view attribute_name) const { return find_attribute(attribute_name) >= 0; }
 
+    // set nan for the elements [pos, pos + size), divided in contiguous ranges over multiple threads
+    // (see common/threading.hpp)
+    // every thread sets at least set_nan_bytes_per_thread bytes, so small buffers are set sequentially
+    void set_nan_parallel(RawDataPtr ptr, Idx pos, Idx size, Idx threading) const {
+        Idx const n_thread =
+            get_n_threads(threading, static_cast<Idx>(this->size * std::max(size, Idx{0}) / set_nan_bytes_per_thread));
+        run_in_threads(n_thread, [this, ptr, pos, size, n_thread](Idx thread_number) {
+            Idx const begin = pos + size * thread_number / n_thread;
+            Idx const end = pos + size * (thread_number + 1) / n_thread;
+            set_nan(ptr, begin, end - begin);
+        });
+    }
+
     RawDataPtr advance_ptr(RawDataPtr ptr, Idx difference) const {
         return reinterpret_cast<char*>(ptr) + difference * size;
     }
@@ -17,6 +17,53 @@ template <class StructType, class ValueType> struct trait_pointer_to_member<Valu
     using struct_type = StructType;
 };
 
+// typed bulk copy between an attribute of a row-based buffer and a (strided) value array
+// the access pattern is resolved once per call instead of once per element
+template <auto member_ptr, class MemberPtr = decltype(member_ptr)> struct attribute_bulk_copy {
+    using ValueType = typename trait_pointer_to_member<MemberPtr>::value_type;
+    using StructType = typename trait_pointer_to_member<MemberPtr>::struct_type;
+
+    static void set_values(RawDataPtr buffer_ptr, RawDataConstPtr value_ptr, Idx pos, Idx size, Idx stride) {
+        StructType* const buffer = reinterpret_cast<StructType*>(buffer_ptr) + pos;
+        if (stride == 0) {
+            ValueType const value = *reinterpret_cast<ValueType const*>(value_ptr);
+            for (Idx i = 0; i != size; ++i) {
+                buffer[i].*member_ptr = value;
+            }
+        } else if (stride == static_cast<Idx>(sizeof(ValueType))) {
+            ValueType const* const values = reinterpret_cast<ValueType const*>(value_ptr) + pos;
+            for (Idx i = 0; i != size; ++i) {
+                buffer[i].*member_ptr = values[i];
+            }
+        } else {
+            char const* const values = reinterpret_cast<char const*>(value_ptr) + stride * pos;
+            for (Idx i = 0; i != size; ++i) {
+                buffer[i].*member_ptr = *reinterpret_cast<ValueType const*>(values + stride * i);
+            }
+        }
+    }
+
+    static void get_values(RawDataConstPtr buffer_ptr, RawDataPtr value_ptr, Idx pos, Idx size, Idx stride) {
+        StructType const* const buffer = reinterpret_cast<StructType const*>(buffer_ptr) + pos;
+        if (stride == 0) {
+            // every element is written to the same destination, only the last one remains
+            if (size > 0) {
+                *reinterpret_cast<ValueType*>(value_ptr) = buffer[size - 1].*member_ptr;
+            }
+        } else if (stride == static_cast<Idx>(sizeof(ValueType))) {
+            ValueType* const values = reinterpret_cast<ValueType*>(value_ptr) + pos;
+            for (Idx i = 0; i != size; ++i) {
+                values[i] = buffer[i].*member_ptr;
+            }
+        } else {
+            char* const values = reinterpret_cast<char*>(value_ptr) + stride * pos;
+            for (Idx i = 0; i != size; ++i) {
+                *reinterpret_cast<ValueType*>(values + stride * i) = buffer[i].*member_ptr;
+            }
+        }
+    }
+};
+
 // getter for meta attribute
 template <auto member_ptr, class MemberPtr = decltype(member_ptr)>
 constexpr MetaAttribute get_meta_attribute(size_t offset, char const* attribute_name) {
@@ -47,6 +94,8 @@ constexpr MetaAttribute get_meta_attribute(size_t offset, char const* attribute_
                 *reinterpret_cast<ValueType*>(value_ptr) =
                     (reinterpret_cast<StructType const*>(buffer_ptr) + pos)->*member_ptr;
             },
+        .set_values = &attribute_bulk_copy<member_ptr>::set_values,
+        .get_values = &attribute_bulk_copy<member_ptr>::get_values,
         .compare_value = [](RawDataConstPtr ptr_x, RawDataConstPtr ptr_y, double atol, double rtol, Idx pos) -> bool {
             ValueType const& x = (reinterpret_cast<StructType const*>(ptr_x) + pos)->*member_ptr;
             ValueType const& y = (reinterpret_cast<StructType const*>(ptr_y) + pos)->*member_ptr;
@@ -70,8 +119,10 @@ template <class StructType> constexpr MetaComponent get_meta_component(char cons
         .attributes = get_attributes_list<StructType>::value,
         .set_nan =
             [](RawDataPtr buffer_ptr, Idx pos, Idx size) {
-                auto ptr = reinterpret_cast<StructType*>(buffer_ptr);
-                std::fill(ptr + pos, ptr + pos + size, StructType{});
+                // default constructed struct with all attributes nan, used as pattern for the whole range
+                static StructType const nan_template{};
+                fill_with_pattern(reinterpret_cast<StructType*>(buffer_ptr) + pos, &nan_template, sizeof(StructType),
+                                  size);
             },
         .create_buffer = [](Idx size) -> RawDataPtr { return new StructType[size]; },
         .destroy_buffer = [](RawDataConstPtr buffer_ptr) { delete[] reinterpret_cast<StructType const*>(buffer_ptr); },
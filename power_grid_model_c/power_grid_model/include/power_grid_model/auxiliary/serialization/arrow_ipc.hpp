@@ -0,0 +1,1070 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// import and export of columnar component data in the Arrow IPC streaming and file formats
+// the Arrow libraries are not needed: the flatbuffer messages of the Arrow format are encoded and decoded here,
+//    restricted to what is needed for the attribute types
+
+#include "../../common/common.hpp"
+#include "../../common/enum.hpp"
+#include "../../common/exception.hpp"
+#include "../../common/three_phase_tensor.hpp"
+#include "../dataset.hpp"
+#include "../meta_data.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <numeric>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace power_grid_model::meta_data {
+
+namespace arrow_ipc {
+
+constexpr std::string_view file_magic{"ARROW1"};
+// the magic at the start of the file is padded to 8 bytes
+constexpr size_t file_header_size = 8;
+constexpr uint32_t continuation_marker = 0xFFFFFFFFU;
+// all messages and buffers are aligned to 8 bytes
+constexpr size_t alignment = 8;
+
+// identifiers of the Arrow flatbuffer schema: Message.fbs, Schema.fbs and File.fbs
+constexpr int16_t metadata_version = 4; // V5
+constexpr int16_t min_metadata_version = 3; // V4
+constexpr int16_t little_endian = 0;
+constexpr int16_t precision_double = 2;
+
+enum class MessageHeader : uint8_t { schema = 1, dictionary_batch = 2, record_batch = 3 };
+
+enum class TypeId : uint8_t {
+    null_type = 1,
+    int_type = 2,
+    floating_point = 3,
+    binary = 4,
+    utf8 = 5,
+    bool_type = 6,
+    decimal = 7,
+    date = 8,
+    time = 9,
+    timestamp = 10,
+    interval = 11,
+    list = 12,
+    struct_type = 13,
+    fixed_size_binary = 15,
+    fixed_size_list = 16,
+    map = 17,
+    duration = 18,
+    large_binary = 19,
+    large_utf8 = 20,
+    large_list = 21,
+};
+
+// slots of the fields of the tables
+namespace message_slot {
+constexpr uint16_t version = 0;
+constexpr uint16_t header_type = 1;
+constexpr uint16_t header = 2;
+constexpr uint16_t body_length = 3;
+} // namespace message_slot
+namespace schema_slot {
+constexpr uint16_t endianness = 0;
+constexpr uint16_t fields = 1;
+constexpr uint16_t custom_metadata = 2;
+} // namespace schema_slot
+namespace field_slot {
+constexpr uint16_t name = 0;
+constexpr uint16_t nullable = 1;
+constexpr uint16_t type_type = 2;
+constexpr uint16_t type = 3;
+constexpr uint16_t dictionary = 4;
+constexpr uint16_t children = 5;
+} // namespace field_slot
+namespace key_value_slot {
+constexpr uint16_t key = 0;
+constexpr uint16_t value = 1;
+} // namespace key_value_slot
+namespace int_slot {
+constexpr uint16_t bit_width = 0;
+constexpr uint16_t is_signed = 1;
+} // namespace int_slot
+namespace floating_point_slot {
+constexpr uint16_t precision = 0;
+} // namespace floating_point_slot
+namespace fixed_size_list_slot {
+constexpr uint16_t list_size = 0;
+} // namespace fixed_size_list_slot
+namespace record_batch_slot {
+constexpr uint16_t length = 0;
+constexpr uint16_t nodes = 1;
+constexpr uint16_t buffers = 2;
+constexpr uint16_t compression = 3;
+} // namespace record_batch_slot
+namespace footer_slot {
+constexpr uint16_t version = 0;
+constexpr uint16_t schema = 1;
+constexpr uint16_t dictionaries = 2;
+constexpr uint16_t record_batches = 3;
+} // namespace footer_slot
+
+// FieldNode {length, null_count} and Buffer {offset, length} are structs of two longs
+// Block {offset, metaDataLength, bodyLength} is a struct of three longs, the int of the metadata length being padded
+constexpr size_t words_per_node = 2;
+constexpr size_t words_per_buffer = 2;
+constexpr size_t words_per_block = 3;
+
+constexpr size_t round_up(size_t size, size_t align) { return (size + align - 1) / align * align; }
+
+// all values are little endian, as is the native layout on the supported platforms
+template <class T> T load(std::span<char const> data, size_t pos) {
+    if (pos > data.size() || data.size() - pos < sizeof(T)) {
+        throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+    }
+    T value{};
+    std::memcpy(&value, data.data() + pos, sizeof(T));
+    return value;
+}
+
+template <class T> void append(std::vector<char>& buffer, T value) {
+    auto const bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+    buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+}
+
+inline void pad(std::vector<char>& buffer, size_t align) { buffer.resize(round_up(buffer.size(), align)); }
+
+inline void check_little_endian() {
+    if (!is_little_endian()) {
+        throw SerializationError{"Arrow IPC data is only supported on little endian platforms!\n"};
+    }
+}
+
+// a flatbuffer table under construction, the fields are identified by their slot in the schema
+class FlatTable {
+  public:
+    struct Scalar {
+        std::array<char, sizeof(int64_t)> bytes{};
+        size_t size{};
+    };
+    struct String {
+        std::string value;
+    };
+    // vector of structs of 8 byte words
+    struct Structs {
+        std::vector<int64_t> words;
+        size_t n_structs{};
+    };
+    // a single table or a vector of tables
+    struct Tables {
+        std::vector<FlatTable> tables;
+        bool is_vector{};
+    };
+    struct Field {
+        uint16_t slot{};
+        std::variant<Scalar, String, Structs, Tables> value;
+    };
+
+    template <class T>
+        requires std::is_arithmetic_v<T>
+    FlatTable& add_scalar(uint16_t slot, T value) {
+        Scalar scalar{.size = sizeof(T)};
+        std::memcpy(scalar.bytes.data(), &value, sizeof(T));
+        fields_.push_back({.slot = slot, .value = scalar});
+        return *this;
+    }
+    FlatTable& add_string(uint16_t slot, std::string_view value) {
+        fields_.push_back({.slot = slot, .value = String{.value = std::string{value}}});
+        return *this;
+    }
+    FlatTable& add_structs(uint16_t slot, std::vector<int64_t> words, size_t words_per_struct) {
+        size_t const n_structs = words.size() / words_per_struct;
+        fields_.push_back({.slot = slot, .value = Structs{.words = std::move(words), .n_structs = n_structs}});
+        return *this;
+    }
+    FlatTable& add_table(uint16_t slot, FlatTable table) {
+        std::vector<FlatTable> tables;
+        tables.push_back(std::move(table));
+        fields_.push_back({.slot = slot, .value = Tables{.tables = std::move(tables), .is_vector = false}});
+        return *this;
+    }
+    FlatTable& add_tables(uint16_t slot, std::vector<FlatTable> tables) {
+        fields_.push_back({.slot = slot, .value = Tables{.tables = std::move(tables), .is_vector = true}});
+        return *this;
+    }
+
+    std::vector<Field> const& fields() const { return fields_; }
+
+  private:
+    std::vector<Field> fields_;
+};
+
+// write the flatbuffer front to back, every table is directly preceded by its vtable
+//    the objects referenced by a table are written after it, so all offsets point forward
+class FlatBufferWriter {
+  public:
+    // the buffer is padded to a multiple of 8 bytes
+    static std::vector<char> finish(FlatTable const& root) {
+        FlatBufferWriter writer;
+        append(writer.buffer_, uint32_t{});
+        writer.patch_offset(0, writer.write_table(root));
+        pad(writer.buffer_, alignment);
+        return std::move(writer.buffer_);
+    }
+
+  private:
+    std::vector<char> buffer_;
+
+    static size_t inline_size(FlatTable::Field const& field) {
+        if (auto const* scalar = std::get_if<FlatTable::Scalar>(&field.value); scalar != nullptr) {
+            return scalar->size;
+        }
+        return sizeof(uint32_t);
+    }
+
+    void patch_offset(size_t pos, size_t target) {
+        auto const offset = static_cast<uint32_t>(target - pos);
+        std::memcpy(buffer_.data() + pos, &offset, sizeof(offset));
+    }
+
+    size_t write_table(FlatTable const& table) {
+        auto const& fields = table.fields();
+        uint16_t n_slots{};
+        for (auto const& field : fields) {
+            n_slots = std::max(n_slots, static_cast<uint16_t>(field.slot + 1));
+        }
+        // larger fields first, so that every field is aligned within the 8 byte aligned table
+        std::vector<size_t> order(fields.size());
+        std::iota(order.begin(), order.end(), size_t{});
+        std::ranges::stable_sort(order, std::greater{}, [&fields](size_t idx) { return inline_size(fields[idx]); });
+        std::vector<uint16_t> slot_offsets(n_slots);
+        std::vector<size_t> field_offsets(fields.size());
+        size_t table_size = sizeof(int32_t);
+        for (size_t const idx : order) {
+            size_t const size = inline_size(fields[idx]);
+            table_size = round_up(table_size, size);
+            field_offsets[idx] = table_size;
+            slot_offsets[fields[idx].slot] = static_cast<uint16_t>(table_size);
+            table_size += size;
+        }
+
+        pad(buffer_, sizeof(uint16_t));
+        size_t const vtable_pos = buffer_.size();
+        append(buffer_, static_cast<uint16_t>(sizeof(uint16_t) * (2 + n_slots)));
+        append(buffer_, static_cast<uint16_t>(table_size));
+        for (uint16_t const slot_offset : slot_offsets) {
+            append(buffer_, slot_offset);
+        }
+        pad(buffer_, alignment);
+        size_t const table_pos = buffer_.size();
+        buffer_.resize(table_pos + round_up(table_size, alignment));
+        auto const vtable_offset = static_cast<int32_t>(table_pos - vtable_pos);
+        std::memcpy(buffer_.data() + table_pos, &vtable_offset, sizeof(vtable_offset));
+
+        for (size_t idx = 0; idx != fields.size(); ++idx) {
+            size_t const field_pos = table_pos + field_offsets[idx];
+            std::visit(
+                [this, field_pos]<class Value>(Value const& value) {
+                    if constexpr (std::same_as<Value, FlatTable::Scalar>) {
+                        std::memcpy(buffer_.data() + field_pos, value.bytes.data(), value.size);
+                    } else {
+                        patch_offset(field_pos, write_object(value));
+                    }
+                },
+                fields[idx].value);
+        }
+        return table_pos;
+    }
+
+    size_t write_object(FlatTable::String const& string) {
+        pad(buffer_, sizeof(uint32_t));
+        size_t const pos = buffer_.size();
+        append(buffer_, static_cast<uint32_t>(string.value.size()));
+        buffer_.insert(buffer_.end(), string.value.begin(), string.value.end());
+        buffer_.push_back('\0');
+        return pos;
+    }
+
+    size_t write_object(FlatTable::Structs const& structs) {
+        // the structs after the length are 8 byte aligned
+        buffer_.resize(round_up(buffer_.size() + sizeof(uint32_t), alignment) - sizeof(uint32_t));
+        size_t const pos = buffer_.size();
+        append(buffer_, static_cast<uint32_t>(structs.n_structs));
+        for (int64_t const word : structs.words) {
+            append(buffer_, word);
+        }
+        return pos;
+    }
+
+    size_t write_object(FlatTable::Tables const& tables) {
+        if (!tables.is_vector) {
+            return write_table(tables.tables.front());
+        }
+        pad(buffer_, sizeof(uint32_t));
+        size_t const pos = buffer_.size();
+        append(buffer_, static_cast<uint32_t>(tables.tables.size()));
+        buffer_.resize(buffer_.size() + sizeof(uint32_t) * tables.tables.size());
+        for (size_t idx = 0; idx != tables.tables.size(); ++idx) {
+            size_t const element_pos = pos + sizeof(uint32_t) * (idx + 1);
+            patch_offset(element_pos, write_table(tables.tables[idx]));
+        }
+        return pos;
+    }
+};
+
+// bounds checked read access to a table of a flatbuffer
+class FlatTableView {
+  public:
+    FlatTableView(std::span<char const> buffer, size_t table_pos) : buffer_{buffer}, table_pos_{table_pos} {
+        auto const vtable_pos = static_cast<int64_t>(table_pos) - load<int32_t>(buffer_, table_pos);
+        if (vtable_pos < 0) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+        vtable_pos_ = static_cast<size_t>(vtable_pos);
+        vtable_size_ = load<uint16_t>(buffer_, vtable_pos_);
+        if (vtable_size_ < 2 * sizeof(uint16_t) || vtable_pos_ + vtable_size_ > buffer_.size() ||
+            table_pos_ + load<uint16_t>(buffer_, vtable_pos_ + sizeof(uint16_t)) > buffer_.size()) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+    }
+
+    static FlatTableView root(std::span<char const> buffer) { return {buffer, load<uint32_t>(buffer, 0)}; }
+
+    bool has_field(uint16_t slot) const { return field_pos(slot) != 0; }
+
+    template <class T> T get_scalar(uint16_t slot, T default_value) const {
+        size_t const pos = field_pos(slot);
+        return pos == 0 ? default_value : load<T>(buffer_, pos);
+    }
+
+    FlatTableView get_table(uint16_t slot) const {
+        size_t const pos = field_pos(slot);
+        if (pos == 0) {
+            throw SerializationError{"Arrow IPC data misses a required table!\n"};
+        }
+        return {buffer_, dereference(pos)};
+    }
+
+    std::string_view get_string(uint16_t slot) const {
+        size_t const pos = field_pos(slot);
+        if (pos == 0) {
+            return {};
+        }
+        size_t const string_pos = dereference(pos);
+        size_t const length = load<uint32_t>(buffer_, string_pos);
+        check_range(string_pos + sizeof(uint32_t), length);
+        return {buffer_.data() + string_pos + sizeof(uint32_t), length};
+    }
+
+    size_t get_vector_size(uint16_t slot) const {
+        size_t const pos = field_pos(slot);
+        return pos == 0 ? 0 : load<uint32_t>(buffer_, dereference(pos));
+    }
+
+    FlatTableView get_table_at(uint16_t slot, size_t idx) const {
+        size_t const element_pos = vector_element_pos(slot, idx, sizeof(uint32_t));
+        return {buffer_, dereference(element_pos)};
+    }
+
+    // the word of the struct at the index in a vector of structs of 8 byte words
+    int64_t get_struct_word(uint16_t slot, size_t idx, size_t words_per_struct, size_t word) const {
+        size_t const struct_pos = vector_element_pos(slot, idx, sizeof(int64_t) * words_per_struct);
+        return load<int64_t>(buffer_, struct_pos + sizeof(int64_t) * word);
+    }
+
+  private:
+    std::span<char const> buffer_;
+    size_t table_pos_;
+    size_t vtable_pos_{};
+    size_t vtable_size_{};
+
+    void check_range(size_t pos, size_t size) const {
+        if (pos > buffer_.size() || buffer_.size() - pos < size) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+    }
+
+    // zero for a field which is absent
+    size_t field_pos(uint16_t slot) const {
+        size_t const entry_pos = sizeof(uint16_t) * (2 + static_cast<size_t>(slot));
+        if (entry_pos + sizeof(uint16_t) > vtable_size_) {
+            return 0;
+        }
+        auto const offset = load<uint16_t>(buffer_, vtable_pos_ + entry_pos);
+        return offset == 0 ? 0 : table_pos_ + offset;
+    }
+
+    size_t dereference(size_t pos) const { return pos + load<uint32_t>(buffer_, pos); }
+
+    size_t vector_element_pos(uint16_t slot, size_t idx, size_t element_size) const {
+        if (idx >= get_vector_size(slot)) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+        size_t const element_pos = dereference(field_pos(slot)) + sizeof(uint32_t) + idx * element_size;
+        check_range(element_pos, element_size);
+        return element_pos;
+    }
+};
+
+// the Arrow field of an attribute
+//    c_int32 and c_int8 are signed integers, c_double is a double and c_double3 is a fixed size list of 3 doubles
+inline FlatTable attribute_field(std::string_view name, CType ctype) {
+    auto const double_type = [] {
+        return std::move(FlatTable{}.add_scalar(floating_point_slot::precision, precision_double));
+    };
+    auto const int_type = [](int32_t bit_width) {
+        return std::move(
+            FlatTable{}.add_scalar(int_slot::bit_width, bit_width).add_scalar(int_slot::is_signed, uint8_t{1}));
+    };
+
+    FlatTable field;
+    field.add_string(field_slot::name, name).add_scalar(field_slot::nullable, uint8_t{1});
+    std::vector<FlatTable> children;
+    switch (ctype) {
+        using enum CType;
+    case c_int32:
+        field.add_scalar(field_slot::type_type, static_cast<uint8_t>(TypeId::int_type))
+            .add_table(field_slot::type, int_type(32));
+        break;
+    case c_int8:
+        field.add_scalar(field_slot::type_type, static_cast<uint8_t>(TypeId::int_type))
+            .add_table(field_slot::type, int_type(8));
+        break;
+    case c_double:
+        field.add_scalar(field_slot::type_type, static_cast<uint8_t>(TypeId::floating_point))
+            .add_table(field_slot::type, double_type());
+        break;
+    case c_double3:
+        field.add_scalar(field_slot::type_type, static_cast<uint8_t>(TypeId::fixed_size_list))
+            .add_table(field_slot::type,
+                       std::move(FlatTable{}.add_scalar(fixed_size_list_slot::list_size, int32_t{3})));
+        children.push_back(attribute_field("item", c_double));
+        break;
+    default:
+        throw MissingCaseForEnumError{"Arrow field", ctype};
+    }
+    field.add_tables(field_slot::children, std::move(children));
+    return field;
+}
+
+inline bool is_double_field(FlatTableView const& field) {
+    return field.get_scalar(field_slot::type_type, uint8_t{}) == static_cast<uint8_t>(TypeId::floating_point) &&
+           field.get_table(field_slot::type).get_scalar(floating_point_slot::precision, int16_t{}) == precision_double;
+}
+
+inline bool is_int_field(FlatTableView const& field, int32_t bit_width) {
+    if (field.get_scalar(field_slot::type_type, uint8_t{}) != static_cast<uint8_t>(TypeId::int_type)) {
+        return false;
+    }
+    auto const type = field.get_table(field_slot::type);
+    return type.get_scalar(int_slot::bit_width, int32_t{}) == bit_width &&
+           type.get_scalar(int_slot::is_signed, uint8_t{}) != 0;
+}
+
+inline bool field_matches(FlatTableView const& field, CType ctype) {
+    switch (ctype) {
+        using enum CType;
+    case c_int32:
+        return is_int_field(field, 32);
+    case c_int8:
+        return is_int_field(field, 8);
+    case c_double:
+        return is_double_field(field);
+    case c_double3:
+        return field.get_scalar(field_slot::type_type, uint8_t{}) ==
+                   static_cast<uint8_t>(TypeId::fixed_size_list) &&
+               field.get_table(field_slot::type).get_scalar(fixed_size_list_slot::list_size, int32_t{}) == 3 &&
+               field.get_vector_size(field_slot::children) == 1 &&
+               is_double_field(field.get_table_at(field_slot::children, 0));
+    default:
+        throw MissingCaseForEnumError{"Arrow field", ctype};
+    }
+}
+
+// the number of field nodes and buffers of a column in a record batch, including those of the children
+struct ColumnLayout {
+    MetaAttribute const* attribute{}; // no attribute for a column which is skipped
+    size_t n_nodes{};
+    size_t n_buffers{};
+};
+
+inline void count_layout(FlatTableView const& field, ColumnLayout& layout) {
+    ++layout.n_nodes;
+    bool has_children{};
+    switch (static_cast<TypeId>(field.get_scalar(field_slot::type_type, uint8_t{}))) {
+        using enum TypeId;
+    case null_type:
+        break;
+    case int_type:
+    case floating_point:
+    case bool_type:
+    case decimal:
+    case date:
+    case time:
+    case timestamp:
+    case interval:
+    case fixed_size_binary:
+    case duration:
+        layout.n_buffers += 2;
+        break;
+    case binary:
+    case utf8:
+    case large_binary:
+    case large_utf8:
+        layout.n_buffers += 3;
+        break;
+    case list:
+    case large_list:
+    case map:
+        layout.n_buffers += 2;
+        has_children = true;
+        break;
+    case struct_type:
+    case fixed_size_list:
+        layout.n_buffers += 1;
+        has_children = true;
+        break;
+    default:
+        throw SerializationError{
+            std::format("The type of Arrow column {} is not supported!\n", field.get_string(field_slot::name))};
+    }
+    if (has_children) {
+        for (size_t idx = 0; idx != field.get_vector_size(field_slot::children); ++idx) {
+            count_layout(field.get_table_at(field_slot::children, idx), layout);
+        }
+    }
+}
+
+inline std::vector<ColumnLayout> read_schema(FlatTableView const& schema, MetaComponent const& component) {
+    if (schema.get_scalar(schema_slot::endianness, little_endian) != little_endian) {
+        throw SerializationError{"Big endian Arrow IPC data is not supported!\n"};
+    }
+    size_t const n_fields = schema.get_vector_size(schema_slot::fields);
+    std::vector<ColumnLayout> layouts(n_fields);
+    for (size_t idx = 0; idx != n_fields; ++idx) {
+        auto const field = schema.get_table_at(schema_slot::fields, idx);
+        auto const name = field.get_string(field_slot::name);
+        if (field.has_field(field_slot::dictionary)) {
+            throw SerializationError{std::format("Dictionary encoded Arrow column {} is not supported!\n", name)};
+        }
+        count_layout(field, layouts[idx]);
+        Idx const attribute_idx = component.find_attribute(name);
+        if (attribute_idx < 0) {
+            continue;
+        }
+        MetaAttribute const& attribute = component.attributes[attribute_idx];
+        if (std::ranges::any_of(layouts, [&attribute](auto const& layout) { return layout.attribute == &attribute; })) {
+            throw SerializationError{std::format("Arrow column {} appears more than once!\n", name)};
+        }
+        if (!field_matches(field, attribute.ctype)) {
+            throw SerializationError{std::format(
+                "The type of Arrow column {} does not match the attribute of component {}!\n", name, component.name)};
+        }
+        layouts[idx].attribute = &attribute;
+    }
+    return layouts;
+}
+
+// one message of the stream, the metadata is a flatbuffer followed by the body
+struct Message {
+    MessageHeader header_type{};
+    std::vector<char> metadata; // copied, so that the flatbuffer is aligned
+    std::span<char const> body;
+
+    FlatTableView header() const { return FlatTableView::root(metadata).get_table(message_slot::header); }
+};
+
+// read the messages of the Arrow IPC data sequentially
+//    the file format is read as the stream it contains, up to the footer
+class MessageReader {
+  public:
+    explicit MessageReader(std::span<char const> data) : data_{data} {
+        if (data_.size() < file_magic.size() || std::string_view{data_.data(), file_magic.size()} != file_magic) {
+            return;
+        }
+        constexpr size_t footer_trailer_size = sizeof(int32_t) + file_magic.size();
+        if (data_.size() < file_header_size + footer_trailer_size ||
+            std::string_view{data_.data() + data_.size() - file_magic.size(), file_magic.size()} != file_magic) {
+            throw SerializationError{"Arrow IPC file is truncated or corrupt!\n"};
+        }
+        auto const footer_size = load<int32_t>(data_, data_.size() - footer_trailer_size);
+        size_t const stream_end = data_.size() - footer_trailer_size - static_cast<size_t>(footer_size);
+        if (footer_size < 0 || stream_end < file_header_size || stream_end > data_.size()) {
+            throw SerializationError{"Arrow IPC file is truncated or corrupt!\n"};
+        }
+        data_ = data_.subspan(0, stream_end);
+        offset_ = file_header_size;
+    }
+
+    // false at the end of the stream
+    bool next(Message& message) {
+        if (offset_ == data_.size()) {
+            return false;
+        }
+        auto metadata_size = load<uint32_t>(data_, offset_);
+        offset_ += sizeof(uint32_t);
+        // the continuation marker is absent in data written before Arrow 0.15
+        if (metadata_size == continuation_marker) {
+            metadata_size = load<uint32_t>(data_, offset_);
+            offset_ += sizeof(uint32_t);
+        }
+        if (metadata_size == 0) {
+            return false;
+        }
+        auto const metadata = bytes(metadata_size);
+        message.metadata.assign(metadata.begin(), metadata.end());
+        auto const root = FlatTableView::root(message.metadata);
+        if (root.get_scalar(message_slot::version, int16_t{}) < min_metadata_version) {
+            throw SerializationError{"Arrow IPC data of a metadata version before V4 is not supported!\n"};
+        }
+        message.header_type = static_cast<MessageHeader>(root.get_scalar(message_slot::header_type, uint8_t{}));
+        auto const body_length = root.get_scalar(message_slot::body_length, int64_t{});
+        if (body_length < 0) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+        message.body = bytes(static_cast<size_t>(body_length));
+        return true;
+    }
+
+  private:
+    std::span<char const> data_;
+    size_t offset_{};
+
+    std::span<char const> bytes(size_t size) {
+        if (offset_ > data_.size() || data_.size() - offset_ < size) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+        auto const result = data_.subspan(offset_, size);
+        offset_ += size;
+        return result;
+    }
+};
+
+// an array of a column in a record batch
+//    for c_double3, the values and their validity are those of the doubles in the child array
+struct ColumnData {
+    MetaAttribute const* attribute{};
+    Idx null_count{};
+    std::span<char const> validity;
+    Idx value_null_count{};
+    std::span<char const> value_validity;
+    std::span<char const> values;
+};
+
+struct RecordBatchData {
+    Idx length{};
+    std::vector<ColumnData> columns; // only the columns of attributes
+};
+
+inline RecordBatchData read_record_batch(Message const& message, std::vector<ColumnLayout> const& layouts) {
+    using namespace record_batch_slot;
+
+    auto const record_batch = message.header();
+    if (record_batch.has_field(compression)) {
+        throw SerializationError{"Compressed Arrow IPC data is not supported!\n"};
+    }
+    RecordBatchData result{.length = record_batch.get_scalar(length, int64_t{}), .columns = {}};
+    if (result.length < 0) {
+        throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+    }
+
+    auto const node = [&record_batch, &result](size_t idx, Idx n_values) {
+        Idx const node_length = record_batch.get_struct_word(nodes, idx, words_per_node, 0);
+        Idx const null_count = record_batch.get_struct_word(nodes, idx, words_per_node, 1);
+        if (node_length != result.length * n_values || null_count < 0 || null_count > node_length) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+        return null_count;
+    };
+    auto const buffer = [&record_batch, &message](size_t idx, size_t min_size) {
+        int64_t const offset = record_batch.get_struct_word(buffers, idx, words_per_buffer, 0);
+        int64_t const size = record_batch.get_struct_word(buffers, idx, words_per_buffer, 1);
+        if (offset < 0 || size < 0 || static_cast<size_t>(offset) > message.body.size() ||
+            message.body.size() - static_cast<size_t>(offset) < static_cast<size_t>(size) ||
+            static_cast<size_t>(size) < min_size) {
+            throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+        }
+        return message.body.subspan(static_cast<size_t>(offset), static_cast<size_t>(size));
+    };
+
+    auto const n_values = static_cast<size_t>(result.length);
+    size_t node_idx{};
+    size_t buffer_idx{};
+    for (auto const& layout : layouts) {
+        if (layout.attribute != nullptr) {
+            ColumnData column{};
+            column.attribute = layout.attribute;
+            column.null_count = node(node_idx, 1);
+            column.validity = buffer(buffer_idx, column.null_count > 0 ? (n_values + 7) / 8 : 0);
+            if (layout.attribute->ctype == CType::c_double3) {
+                column.value_null_count = node(node_idx + 1, 3);
+                column.value_validity =
+                    buffer(buffer_idx + 1, column.value_null_count > 0 ? (3 * n_values + 7) / 8 : 0);
+                column.values = buffer(buffer_idx + 2, n_values * layout.attribute->size);
+            } else {
+                column.values = buffer(buffer_idx + 1, n_values * layout.attribute->size);
+            }
+            result.columns.push_back(column);
+        }
+        node_idx += layout.n_nodes;
+        buffer_idx += layout.n_buffers;
+    }
+    if (node_idx != record_batch.get_vector_size(nodes) || buffer_idx != record_batch.get_vector_size(buffers)) {
+        throw SerializationError{"Arrow IPC data is truncated or corrupt!\n"};
+    }
+    return result;
+}
+
+inline bool is_valid(std::span<char const> validity, size_t idx) {
+    return ((static_cast<unsigned char>(validity[idx / 8]) >> (idx % 8)) & 1U) != 0;
+}
+
+// the validity bitmap of the values, a value is null if it is nan
+template <class T> Idx build_validity(std::span<T const> values, std::vector<char>& validity) {
+    validity.assign((values.size() + 7) / 8, char{});
+    Idx null_count{};
+    for (size_t idx = 0; idx != values.size(); ++idx) {
+        if (is_nan(values[idx])) {
+            ++null_count;
+        } else {
+            validity[idx / 8] = static_cast<char>(static_cast<unsigned char>(validity[idx / 8]) | (1U << (idx % 8)));
+        }
+    }
+    return null_count;
+}
+
+static_assert(sizeof(RealValue<asymmetric_t>) == 3 * sizeof(double));
+
+} // namespace arrow_ipc
+
+// export the components of a dataset as Arrow IPC data, one stream or file per component
+//    every attribute is a column, nan values are nulls
+//    a uniform component is one record batch, otherwise every scenario of the batch is a record batch
+//    the schema metadata has the names of the dataset and the component as pgm_dataset and pgm_component
+class ArrowExporter {
+  public:
+    // not copyable
+    ArrowExporter(ArrowExporter const&) = delete;
+    ArrowExporter& operator=(ArrowExporter const&) = delete;
+    // not movable
+    ArrowExporter(ArrowExporter&&) = delete;
+    ArrowExporter& operator=(ArrowExporter&&) = delete;
+    // destructor
+    ~ArrowExporter() = default;
+
+    ArrowExporter(ConstDataset dataset_handler, ArrowIpcFormat format)
+        : format_{format}, dataset_handler_{std::move(dataset_handler)} {
+        arrow_ipc::check_little_endian();
+        if (format_ != ArrowIpcFormat::stream && format_ != ArrowIpcFormat::file) {
+            throw SerializationError{
+                std::format("Unsupported Arrow IPC format: {}\n", static_cast<int>(static_cast<IntS>(format_)))};
+        }
+    }
+
+    // the buffer is valid until the next export
+    std::span<char const> get_component(std::string_view component) {
+        using namespace arrow_ipc;
+
+        Idx const component_idx = dataset_handler_.find_component(component, true);
+        ComponentInfo const& info = dataset_handler_.get_component_info(component_idx);
+        auto const& buffer = dataset_handler_.get_buffer(component_idx);
+        store_columns(info, buffer);
+
+        buffer_.clear();
+        blocks_.clear();
+        if (format_ == ArrowIpcFormat::file) {
+            buffer_.insert(buffer_.end(), file_magic.begin(), file_magic.end());
+            pad(buffer_, file_header_size);
+        }
+        write_message(MessageHeader::schema, schema_table(*info.component), {});
+        if (info.elements_per_scenario >= 0) {
+            if (dataset_handler_.batch_size() > 0) {
+                write_record_batch(0, info.total_elements);
+            }
+        } else {
+            for (Idx scenario = 0; scenario != dataset_handler_.batch_size(); ++scenario) {
+                write_record_batch(buffer.indptr[scenario], buffer.indptr[scenario + 1]);
+            }
+        }
+        append(buffer_, continuation_marker);
+        append(buffer_, uint32_t{});
+        if (format_ == ArrowIpcFormat::file) {
+            write_footer(*info.component);
+        }
+        return buffer_;
+    }
+
+  private:
+    struct Column {
+        MetaAttribute const* attribute;
+        char const* values;
+    };
+
+    ArrowIpcFormat format_;
+    ConstDataset dataset_handler_;
+    std::vector<Column> columns_;
+    std::vector<std::vector<char>> column_buffers_; // columns gathered from row based buffers
+    std::vector<char> buffer_;
+    std::vector<int64_t> blocks_;
+
+    void store_columns(ComponentInfo const& info, ConstDataset::Buffer const& buffer) {
+        columns_.clear();
+        column_buffers_.clear();
+        if (dataset_handler_.is_columnar(buffer)) {
+            for (auto const& attribute_buffer : buffer.attributes) {
+                columns_.push_back({.attribute = attribute_buffer.meta_attribute,
+                                    .values = static_cast<char const*>(attribute_buffer.data)});
+            }
+            return;
+        }
+        for (auto const& attribute : info.component->attributes) {
+            auto& values = column_buffers_.emplace_back(static_cast<size_t>(info.total_elements) * attribute.size);
+            attribute.get_values(buffer.data, values.data(), 0, info.total_elements, static_cast<Idx>(attribute.size));
+            columns_.push_back({.attribute = &attribute, .values = values.data()});
+        }
+    }
+
+    arrow_ipc::FlatTable schema_table(MetaComponent const& component) const {
+        using namespace arrow_ipc;
+
+        std::vector<FlatTable> fields;
+        for (auto const& column : columns_) {
+            fields.push_back(attribute_field(column.attribute->name, column.attribute->ctype));
+        }
+        auto const key_value = [](std::string_view key, std::string_view value) {
+            return std::move(FlatTable{}.add_string(key_value_slot::key, key).add_string(key_value_slot::value, value));
+        };
+        std::vector<FlatTable> metadata;
+        metadata.push_back(key_value("pgm_dataset", dataset_handler_.dataset().name));
+        metadata.push_back(key_value("pgm_component", component.name));
+
+        FlatTable schema;
+        schema.add_scalar(schema_slot::endianness, little_endian)
+            .add_tables(schema_slot::fields, std::move(fields))
+            .add_tables(schema_slot::custom_metadata, std::move(metadata));
+        return schema;
+    }
+
+    void write_message(arrow_ipc::MessageHeader header_type, arrow_ipc::FlatTable header,
+                       std::span<char const> body) {
+        using namespace arrow_ipc;
+
+        FlatTable message;
+        message.add_scalar(message_slot::version, metadata_version)
+            .add_scalar(message_slot::header_type, static_cast<uint8_t>(header_type))
+            .add_table(message_slot::header, std::move(header))
+            .add_scalar(message_slot::body_length, static_cast<int64_t>(body.size()));
+        auto const metadata = FlatBufferWriter::finish(message);
+
+        size_t const offset = buffer_.size();
+        append(buffer_, continuation_marker);
+        append(buffer_, static_cast<uint32_t>(metadata.size()));
+        buffer_.insert(buffer_.end(), metadata.begin(), metadata.end());
+        buffer_.insert(buffer_.end(), body.begin(), body.end());
+        if (header_type == MessageHeader::record_batch) {
+            blocks_.insert(blocks_.end(), {static_cast<int64_t>(offset),
+                                           static_cast<int64_t>(sizeof(uint32_t) * 2 + metadata.size()),
+                                           static_cast<int64_t>(body.size())});
+        }
+    }
+
+    // the elements [begin, end) of the component as one record batch
+    void write_record_batch(Idx begin, Idx end) {
+        using namespace arrow_ipc;
+
+        auto const length = static_cast<size_t>(end - begin);
+        std::vector<char> body;
+        std::vector<int64_t> nodes;
+        std::vector<int64_t> buffers;
+        std::vector<char> validity;
+        auto const add_buffer = [&body, &buffers](std::span<char const> data) {
+            buffers.insert(buffers.end(), {static_cast<int64_t>(body.size()), static_cast<int64_t>(data.size())});
+            body.insert(body.end(), data.begin(), data.end());
+            pad(body, alignment);
+        };
+        auto const add_array = [&nodes, &validity, &add_buffer]<class T>(std::span<T const> values) {
+            Idx const null_count = build_validity(values, validity);
+            nodes.insert(nodes.end(), {static_cast<int64_t>(values.size()), null_count});
+            add_buffer(null_count > 0 ? std::span<char const>{validity} : std::span<char const>{});
+        };
+
+        for (auto const& column : columns_) {
+            ctype_func_selector(column.attribute->ctype, [&]<class T>() {
+                std::span<T const> const values{reinterpret_cast<T const*>(column.values) + begin, length};
+                add_array(values);
+                if constexpr (std::same_as<T, RealValue<asymmetric_t>>) {
+                    add_array(std::span<double const>{reinterpret_cast<double const*>(values.data()), 3 * length});
+                }
+                add_buffer({reinterpret_cast<char const*>(values.data()), length * sizeof(T)});
+            });
+        }
+
+        FlatTable record_batch;
+        record_batch.add_scalar(record_batch_slot::length, static_cast<int64_t>(length))
+            .add_structs(record_batch_slot::nodes, std::move(nodes), words_per_node)
+            .add_structs(record_batch_slot::buffers, std::move(buffers), words_per_buffer);
+        write_message(MessageHeader::record_batch, std::move(record_batch), body);
+    }
+
+    void write_footer(MetaComponent const& component) {
+        using namespace arrow_ipc;
+
+        FlatTable footer;
+        footer.add_scalar(footer_slot::version, metadata_version)
+            .add_table(footer_slot::schema, schema_table(component))
+            .add_structs(footer_slot::dictionaries, {}, words_per_block)
+            .add_structs(footer_slot::record_batches, blocks_, words_per_block);
+        auto const metadata = FlatBufferWriter::finish(footer);
+        buffer_.insert(buffer_.end(), metadata.begin(), metadata.end());
+        append(buffer_, static_cast<int32_t>(metadata.size()));
+        buffer_.insert(buffer_.end(), file_magic.begin(), file_magic.end());
+    }
+};
+
+// import Arrow IPC data as columnar components of a dataset, in the streaming or the file format
+//    the columns are matched by name to the attributes, other columns are skipped
+//    the types of the columns should be those written by the exporter
+//    nulls are set to nan
+// the scenarios are deduced from the record batches
+//    a record batch per scenario of the batch, or all elements evenly divided over the scenarios
+// the columns are used in place if they are a single aligned record batch without nulls
+//    the data should then stay valid and unchanged while the dataset is used
+//    other columns are copied into buffers owned by the importer, which should outlive the dataset
+class ArrowImporter {
+  public:
+    // not copyable
+    ArrowImporter(ArrowImporter const&) = delete;
+    ArrowImporter& operator=(ArrowImporter const&) = delete;
+    // not movable
+    ArrowImporter(ArrowImporter&&) = delete;
+    ArrowImporter& operator=(ArrowImporter&&) = delete;
+    // destructor
+    ~ArrowImporter() = default;
+
+    ArrowImporter() { arrow_ipc::check_little_endian(); }
+
+    void add_component(ConstDataset& dataset, std::string_view component_name, std::span<char const> data) {
+        using namespace arrow_ipc;
+
+        MetaComponent const& component = dataset.dataset().get_component(component_name);
+        MessageReader reader{data};
+        Message message;
+        if (!reader.next(message) || message.header_type != MessageHeader::schema) {
+            throw SerializationError{"Arrow IPC data does not start with a schema!\n"};
+        }
+        auto const layouts = read_schema(message.header(), component);
+        std::vector<RecordBatchData> record_batches;
+        while (reader.next(message)) {
+            if (message.header_type != MessageHeader::record_batch) {
+                throw SerializationError{"Arrow IPC data may only contain record batches after the schema!\n"};
+            }
+            record_batches.push_back(read_record_batch(message, layouts));
+        }
+
+        Idx const total_elements = std::transform_reduce(record_batches.cbegin(), record_batches.cend(), Idx{},
+                                                         std::plus{}, [](auto const& batch) { return batch.length; });
+        Idx const elements_per_scenario = scenario_layout(dataset, component, record_batches, total_elements);
+        auto const n_columns = static_cast<size_t>(
+            std::ranges::count_if(layouts, [](auto const& layout) { return layout.attribute != nullptr; }));
+        std::vector<void const*> attribute_data(n_columns);
+        for (size_t column_idx = 0; column_idx != n_columns; ++column_idx) {
+            attribute_data[column_idx] = import_column(record_batches, column_idx, total_elements);
+        }
+
+        Idx const* const indptr = elements_per_scenario < 0 ? indptrs_.back().data() : nullptr;
+        dataset.add_buffer(component_name, elements_per_scenario, total_elements, indptr, nullptr);
+        size_t column_idx{};
+        for (auto const& layout : layouts) {
+            if (layout.attribute != nullptr) {
+                dataset.add_attribute_buffer(component_name, layout.attribute->name, attribute_data[column_idx]);
+                ++column_idx;
+            }
+        }
+    }
+
+  private:
+    std::vector<std::vector<std::byte>> attribute_buffers_;
+    std::vector<std::vector<Idx>> indptrs_;
+
+    // the elements per scenario, or -1 with the indptr stored last for a non-uniform component
+    Idx scenario_layout(ConstDataset const& dataset, MetaComponent const& component,
+                        std::vector<arrow_ipc::RecordBatchData> const& record_batches, Idx total_elements) {
+        Idx const batch_size = dataset.batch_size();
+        if (!dataset.is_batch()) {
+            return total_elements;
+        }
+        if (std::cmp_equal(record_batches.size(), batch_size)) {
+            if (record_batches.empty()) {
+                return 0;
+            }
+            if (std::ranges::all_of(record_batches, [&record_batches](auto const& batch) {
+                    return batch.length == record_batches.front().length;
+                })) {
+                return record_batches.front().length;
+            }
+            auto& indptr = indptrs_.emplace_back(batch_size + 1);
+            for (Idx scenario = 0; scenario != batch_size; ++scenario) {
+                indptr[scenario + 1] = indptr[scenario] + record_batches[scenario].length;
+            }
+            return -1;
+        }
+        if (batch_size > 0 && total_elements % batch_size == 0) {
+            return total_elements / batch_size;
+        }
+        throw SerializationError{
+            std::format("Cannot divide the {} elements of component {} over the {} scenarios of the batch!\n",
+                        total_elements, component.name, batch_size)};
+    }
+
+    void const* import_column(std::vector<arrow_ipc::RecordBatchData> const& record_batches, size_t column_idx,
+                              Idx total_elements) {
+        using namespace arrow_ipc;
+
+        if (record_batches.empty()) {
+            return nullptr;
+        }
+        MetaAttribute const& attribute = *record_batches.front().columns[column_idx].attribute;
+        return ctype_func_selector(attribute.ctype, [&]<class T>() -> void const* {
+            if (record_batches.size() == 1) {
+                ColumnData const& column = record_batches.front().columns[column_idx];
+                if (column.null_count == 0 && column.value_null_count == 0 &&
+                    reinterpret_cast<std::uintptr_t>(column.values.data()) % alignof(T) == 0) {
+                    return column.values.data();
+                }
+            }
+            auto& storage = attribute_buffers_.emplace_back(static_cast<size_t>(total_elements) * sizeof(T));
+            T* values = reinterpret_cast<T*>(storage.data());
+            for (auto const& record_batch : record_batches) {
+                ColumnData const& column = record_batch.columns[column_idx];
+                auto const length = static_cast<size_t>(record_batch.length);
+                std::memcpy(static_cast<void*>(values), column.values.data(), length * sizeof(T));
+                if constexpr (std::same_as<T, RealValue<asymmetric_t>>) {
+                    double* const phase_values = reinterpret_cast<double*>(values);
+                    for (size_t idx = 0; column.value_null_count > 0 && idx != 3 * length; ++idx) {
+                        if (!is_valid(column.value_validity, idx)) {
+                            phase_values[idx] = nan;
+                        }
+                    }
+                }
+                for (size_t idx = 0; column.null_count > 0 && idx != length; ++idx) {
+                    if (!is_valid(column.validity, idx)) {
+                        values[idx] = nan_value<T>;
+                    }
+                }
+                values += length;
+            }
+            return storage.data();
+        });
+    }
+};
+
+} // namespace power_grid_model::meta_data
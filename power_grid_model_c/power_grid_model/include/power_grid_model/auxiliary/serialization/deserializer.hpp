@@ -5,9 +5,12 @@
 #pragma once
 
 #include "common.hpp"
+#include "mapped_file.hpp"
+#include "msgpack_decoder.hpp"
 
 #include "../../common/common.hpp"
 #include "../../common/exception.hpp"
+#include "../../common/threading.hpp"
 #include "../../common/typing.hpp"
 #include "../dataset.hpp"
 #include "../meta_data.hpp"
@@ -16,6 +19,9 @@
 
 #include <msgpack.hpp>
 
+#include <atomic>
+#include <exception>
+#include <filesystem>
 #include <set>
 #include <span>
 #include <sstream>
@@ -37,6 +43,9 @@ constexpr from_msgpack_t from_msgpack;
 struct from_json_t {};
 constexpr from_json_t from_json;
 
+struct from_file_t {};
+constexpr from_file_t from_file;
+
 namespace detail {
 
 using nlohmann::json;
@@ -405,6 +414,8 @@ class Deserializer {
         Buffer const* buffer{nullptr};
         Idx idx{0};
         std::span<AttributeBuffer<void> const> reordered_attribute_buffers;
+        // decoders of the predefined attributes, empty if the generic visitors are used
+        std::span<detail::AttributeDecoder const> attribute_decoders;
     };
 
     using row_based_t = detail::row_based_t;
@@ -412,6 +423,17 @@ class Deserializer {
     static constexpr auto row_based = detail::row_based;
     static constexpr auto columnar = detail::columnar;
 
+    // a contiguous range of scenarios of one component, parsed by one thread
+    struct ParseTask {
+        Idx component_idx;
+        Idx scenario_begin;
+        Idx scenario_end;
+    };
+    // number of tasks per thread per component, more tasks balance the load of unevenly sized scenarios
+    static constexpr Idx parse_tasks_per_thread = 4;
+
+    struct parse_worker_t {};
+
   public:
     // not copyable
     Deserializer(Deserializer const&) = delete;
@@ -431,6 +453,12 @@ class Deserializer {
                  MetaData const& meta_data)
         : Deserializer{create_from_format(data_buffer, serialization_format, meta_data)} {}
 
+    // the file is memory-mapped and msgpack data is parsed directly from the mapping, without copy
+    // the mapping is kept alive for the lifetime of the deserializer
+    Deserializer(from_file_t /* tag */, std::filesystem::path const& file_path,
+                 SerializationFormat serialization_format, MetaData const& meta_data)
+        : Deserializer{create_from_file(MappedFile{file_path}, serialization_format, meta_data)} {}
+
     Deserializer(from_json_t /* tag */, std::string_view json_string, MetaData const& meta_data)
         : meta_data_{&meta_data},
           buffer_from_json_{json_to_msgpack(json_string)},
@@ -446,7 +474,18 @@ class Deserializer {
 
     WritableDataset& get_dataset_info() { return dataset_handler_; }
 
-    void parse() {
+    // elements in a compact list are decoded with a plan per predefined attribute, which is the default
+    // disable it to decode every value with the generic visitors
+    void use_decode_plan(bool enabled) { use_decode_plan_ = enabled; }
+
+    // in parallel, the components and contiguous ranges of scenarios are parsed by separate threads
+    // (see common/threading.hpp)
+    void parse(Idx threading = -1) {
+        Idx const n_tasks = dataset_handler_.n_components() * dataset_handler_.batch_size();
+        if (Idx const n_thread = get_n_threads(threading, n_tasks); n_thread > 1) {
+            parse_parallel(n_thread);
+            return;
+        }
         root_key_ = "data";
         try {
             for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
@@ -459,9 +498,23 @@ class Deserializer {
     }
 
   private:
+    // worker with its own parse position
+    // the attributes, the pre-parsed offsets and the buffers are read from the owner, not copied
+    Deserializer(parse_worker_t /* tag */, Deserializer const& owner)
+        : meta_data_{owner.meta_data_},
+          data_{owner.data_},
+          size_{owner.size_},
+          is_batch_{owner.is_batch_},
+          use_decode_plan_{owner.use_decode_plan_},
+          dataset_handler_{owner.dataset_handler_.is_batch(), owner.dataset_handler_.batch_size(),
+                           owner.dataset_handler_.dataset().name, *owner.meta_data_},
+          owner_{&owner} {}
+
     // data members are order dependent
     // DO NOT modify the order!
     MetaData const* meta_data_;
+    // own mapping if from file
+    MappedFile mapped_file_;
     // own buffer if from json
     msgpack::sbuffer buffer_from_json_;
     // pointer to buffers
@@ -480,6 +533,7 @@ class Deserializer {
     // class members
     std::string version_;
     bool is_batch_{};
+    bool use_decode_plan_{true};
     std::map<MetaComponent const*, std::vector<MetaAttribute const*>, std::less<>> attributes_;
 
     // offset of the msgpack bytes, the number of elements,
@@ -487,6 +541,10 @@ class Deserializer {
     // if a component has no element for a certain scenario, that offset and size will be zero.
     std::vector<std::vector<ComponentByteMeta>> msg_data_offsets_;
     WritableDataset dataset_handler_;
+    // deserializer holding the parse state shared by the workers, nullptr if this is not a worker
+    Deserializer const* owner_{nullptr};
+
+    Deserializer const& shared_state() const { return owner_ == nullptr ? *this : *owner_; }
 
     static msgpack::sbuffer json_to_msgpack(std::string_view json_string) {
         JsonSAXVisitor visitor{};
@@ -753,16 +811,85 @@ class Deserializer {
         return counter.front();
     }
 
+    void parse_parallel(Idx n_thread) {
+        // set nan and indptr of all components before any scenario is parsed
+        root_key_ = "data";
+        try {
+            for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
+                prepare_component(i, n_thread);
+            }
+        } catch (std::exception& e) {
+            handle_error(e);
+        }
+        root_key_ = {};
+
+        Idx const batch_size = dataset_handler_.batch_size();
+        Idx const n_chunks = std::min(batch_size, n_thread * parse_tasks_per_thread);
+        std::vector<ParseTask> tasks;
+        for (Idx component_idx = 0; component_idx != dataset_handler_.n_components(); ++component_idx) {
+            for (Idx chunk = 0; chunk != n_chunks; ++chunk) {
+                tasks.push_back({.component_idx = component_idx,
+                                 .scenario_begin = batch_size * chunk / n_chunks,
+                                 .scenario_end = batch_size * (chunk + 1) / n_chunks});
+            }
+        }
+
+        // there are at least as many tasks as threads, because each task has at least one scenario
+        std::atomic<size_t> next_task{0};
+        std::vector<std::exception_ptr> errors(n_thread);
+        auto const parse_tasks = [this, &tasks, &next_task, &errors](Idx thread_number) {
+            try {
+                Deserializer worker{parse_worker_t{}, *this};
+                for (size_t task_idx = next_task++; task_idx < tasks.size(); task_idx = next_task++) {
+                    worker.parse_task(tasks[task_idx]);
+                }
+            } catch (...) {
+                errors[thread_number] = std::current_exception();
+                next_task = tasks.size();
+            }
+        };
+        run_in_threads(n_thread, parse_tasks);
+        for (auto const& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    void parse_task(ParseTask const& task) {
+        root_key_ = "data";
+        try {
+            parse_component(task.component_idx, task.scenario_begin, task.scenario_end);
+        } catch (std::exception& e) {
+            handle_error(e);
+        }
+        root_key_ = {};
+    }
+
     void parse_component(Idx component_idx) {
+        prepare_component(component_idx);
+        parse_component(component_idx, 0, dataset_handler_.batch_size());
+    }
+
+    void prepare_component(Idx component_idx, Idx threading = -1) {
         if (dataset_handler_.is_row_based(component_idx)) {
-            parse_component(row_based, component_idx);
+            prepare_component(row_based, component_idx, threading);
         } else if (dataset_handler_.is_columnar(component_idx, true)) {
-            parse_component(columnar, component_idx);
+            prepare_component(columnar, component_idx, threading);
+        }
+    }
+
+    void parse_component(Idx component_idx, Idx scenario_begin, Idx scenario_end) {
+        auto const& dataset_handler = shared_state().dataset_handler_;
+        if (dataset_handler.is_row_based(component_idx)) {
+            parse_component(row_based, component_idx, scenario_begin, scenario_end);
+        } else if (dataset_handler.is_columnar(component_idx, true)) {
+            parse_component(columnar, component_idx, scenario_begin, scenario_end);
         }
     }
 
     template <detail::row_based_or_columnar_c row_or_column_t>
-    void parse_component(row_or_column_t row_or_column_tag, Idx component_idx) {
+    void prepare_component(row_or_column_t row_or_column_tag, Idx component_idx, Idx threading) {
         auto const& buffer = dataset_handler_.get_buffer(component_idx);
 
         assert(dataset_handler_.is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
@@ -773,11 +900,10 @@ class Deserializer {
         auto const& info = dataset_handler_.get_component_info(component_idx);
         auto const& msg_data = msg_data_offsets_[component_idx];
 
-        Idx const batch_size = dataset_handler_.batch_size();
         component_key_ = info.component->name;
 
         // set nan
-        set_nan(row_or_column_tag, buffer, info);
+        set_nan(row_or_column_tag, buffer, info, threading);
 
         // handle indptr
         if (info.elements_per_scenario < 0) {
@@ -788,11 +914,24 @@ class Deserializer {
                 msg_data.cbegin(), msg_data.cend(), buffer.indptr.begin() + 1, std::plus{},
                 [](auto const& x) { return x.size; }, Idx{});
         }
+        component_key_ = "";
+    }
+
+    // parse the scenarios [scenario_begin, scenario_end) of a prepared component
+    template <detail::row_based_or_columnar_c row_or_column_t>
+    void parse_component(row_or_column_t row_or_column_tag, Idx component_idx, Idx scenario_begin,
+                         Idx scenario_end) {
+        auto const& shared = shared_state();
+        auto const& buffer = shared.dataset_handler_.get_buffer(component_idx);
+        auto const& info = shared.dataset_handler_.get_component_info(component_idx);
+        auto const& msg_data = shared.msg_data_offsets_[component_idx];
+
+        component_key_ = info.component->name;
 
         // attributes
-        std::span<MetaAttribute const* const> const attributes = [this,
+        std::span<MetaAttribute const* const> const attributes = [&shared,
                                                                   &info]() -> std::span<MetaAttribute const* const> {
-            if (auto const it = attributes_.find(info.component); it != attributes_.cend()) {
+            if (auto const it = shared.attributes_.find(info.component); it != shared.attributes_.cend()) {
                 return it->second;
             }
             return {};
@@ -811,11 +950,16 @@ class Deserializer {
             }
         }
 
-        BufferView const buffer_view{
-            .buffer = &buffer, .idx = 0, .reordered_attribute_buffers = reordered_attribute_buffers};
+        auto const attribute_decoders =
+            use_decode_plan_ ? detail::attribute_decode_plan(attributes) : std::vector<detail::AttributeDecoder>{};
 
-        // all scenarios
-        for (scenario_number_ = 0; scenario_number_ != batch_size; ++scenario_number_) {
+        BufferView const buffer_view{.buffer = &buffer,
+                                     .idx = 0,
+                                     .reordered_attribute_buffers = reordered_attribute_buffers,
+                                     .attribute_decoders = attribute_decoders};
+
+        // all scenarios in the range
+        for (scenario_number_ = scenario_begin; scenario_number_ != scenario_end; ++scenario_number_) {
             Idx const scenario_offset = info.elements_per_scenario < 0 ? buffer_view.buffer->indptr[scenario_number_]
                                                                        : scenario_number_ * info.elements_per_scenario;
 #ifndef NDEBUG
@@ -870,6 +1014,10 @@ class Deserializer {
                        std::span<MetaAttribute const* const> attributes) {
         assert(is_row_based(buffer_view));
 
+        if (parse_array_header_with_plan(buffer_view, attributes)) {
+            parse_array_element_with_plan(tag, buffer_view, component, attributes);
+            return;
+        }
         auto const element_visitor = parse_map_array<visit_map_array_t, move_forward>();
         if (element_visitor.is_map) {
             parse_map_element(tag, buffer_view, element_visitor.size, component);
@@ -882,6 +1030,10 @@ class Deserializer {
                        std::span<MetaAttribute const* const> attributes) {
         assert(is_columnar(buffer_view));
 
+        if (!buffer_view.reordered_attribute_buffers.empty() && parse_array_header_with_plan(buffer_view, attributes)) {
+            parse_array_element_with_plan(tag, buffer_view, component, attributes);
+            return;
+        }
         auto const element_visitor = parse_map_array<visit_map_array_t, stay_offset>();
         if (element_visitor.is_map) {
             parse_map_array<visit_map_array_t, move_forward>();
@@ -954,6 +1106,47 @@ class Deserializer {
         attribute_number_ = -1;
     }
 
+    // an element in a compact list with a decode plan, the offset is moved past the array header
+    bool parse_array_header_with_plan(BufferView const& buffer_view, std::span<MetaAttribute const* const> attributes) {
+        return !buffer_view.attribute_decoders.empty() &&
+               detail::decode_array_header(data_, size_, offset_, attributes.size());
+    }
+
+    // decode the values of the element directly into the buffer
+    // a value which cannot be decoded by its plan is parsed by the generic visitor
+    template <detail::row_based_or_columnar_c row_or_column_t>
+    void parse_array_element_with_plan([[maybe_unused]] row_or_column_t row_or_column_tag,
+                                       BufferView const& buffer_view, MetaComponent const& component,
+                                       std::span<MetaAttribute const* const> attributes) {
+        [[maybe_unused]] char* element_ptr{};
+        if constexpr (detail::is_row_based_v<row_or_column_t>) {
+            element_ptr = reinterpret_cast<char*>(component.advance_ptr(buffer_view.buffer->data, buffer_view.idx));
+        }
+
+        auto const n_attributes = static_cast<Idx>(attributes.size());
+        for (attribute_number_ = 0; attribute_number_ != n_attributes; ++attribute_number_) {
+            MetaAttribute const& attribute = *attributes[attribute_number_];
+            void* value{};
+            if constexpr (detail::is_row_based_v<row_or_column_t>) {
+                value = element_ptr + attribute.offset;
+            } else if (auto const& attribute_buffer = buffer_view.reordered_attribute_buffers[attribute_number_];
+                       attribute_buffer.data != nullptr) {
+                value =
+                    reinterpret_cast<char*>(attribute_buffer.data) + buffer_view.idx * static_cast<Idx>(attribute.size);
+            }
+            if (value == nullptr) {
+                parse_skip();
+            } else if (!buffer_view.attribute_decoders[attribute_number_](data_, size_, offset_, value)) {
+                if constexpr (detail::is_row_based_v<row_or_column_t>) {
+                    parse_attribute(row_or_column_tag, buffer_view, component, attribute);
+                } else {
+                    parse_attribute(buffer_view.reordered_attribute_buffers[attribute_number_], buffer_view.idx);
+                }
+            }
+        }
+        attribute_number_ = -1;
+    }
+
     void parse_attribute(row_based_t /*tag*/, BufferView const& buffer_view, MetaComponent const& component,
                          MetaAttribute const& attribute) { // call relevant parser
         assert(is_row_based(buffer_view));
@@ -991,6 +1184,14 @@ class Deserializer {
         }
     }
 
+    static Deserializer create_from_file(MappedFile mapped_file, SerializationFormat serialization_format,
+                                         MetaData const& meta_data) {
+        Deserializer deserializer = create_from_format(mapped_file.data(), serialization_format, meta_data);
+        // the contents do not move with the mapping, so the pre-parsed positions stay valid
+        deserializer.mapped_file_ = std::move(mapped_file);
+        return deserializer;
+    }
+
     static Deserializer create_from_format(std::span<char const> buffer, SerializationFormat serialization_format,
                                            MetaData const& meta_data) {
         switch (serialization_format) {
@@ -1006,11 +1207,11 @@ class Deserializer {
         }
     }
 
-    static void set_nan(row_based_t /*tag*/, Buffer const& buffer, ComponentInfo const& info) {
+    static void set_nan(row_based_t /*tag*/, Buffer const& buffer, ComponentInfo const& info, Idx threading) {
         assert(is_row_based(buffer));
-        info.component->set_nan(buffer.data, 0, info.total_elements);
+        info.component->set_nan_parallel(buffer.data, 0, info.total_elements, threading);
     }
-    static void set_nan(columnar_t /*tag*/, Buffer const& buffer, ComponentInfo const& info) {
+    static void set_nan(columnar_t /*tag*/, Buffer const& buffer, ComponentInfo const& info, Idx /*threading*/) {
         assert(is_columnar(buffer));
         for (auto const& attribute_buffer : buffer.attributes) {
             if (attribute_buffer.meta_attribute != nullptr) {
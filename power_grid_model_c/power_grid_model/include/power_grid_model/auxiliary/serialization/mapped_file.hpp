@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// read-only view of the contents of a file, memory-mapped where the platform supports it
+
+#include "../../common/exception.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PGM_MAPPED_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace power_grid_model::meta_data {
+
+// the contents stay at the same address when the mapped file is moved
+//    on POSIX platforms, the file is mapped read-only and the kernel is advised that it is read sequentially
+//    on other platforms, the file is read into an owned buffer
+class MappedFile {
+  public:
+    MappedFile() = default;
+    explicit MappedFile(std::filesystem::path const& file_path) { open(file_path); }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    MappedFile(MappedFile&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)},
+          size_{std::exchange(other.size_, 0)},
+          is_mapped_{std::exchange(other.is_mapped_, false)},
+          buffer_{std::move(other.buffer_)} {}
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            is_mapped_ = std::exchange(other.is_mapped_, false);
+            buffer_ = std::move(other.buffer_);
+        }
+        return *this;
+    }
+    ~MappedFile() { release(); }
+
+    std::span<char const> data() const { return {data_, size_}; }
+
+  private:
+    char const* data_{};
+    size_t size_{};
+    bool is_mapped_{};
+    std::vector<char> buffer_;
+
+#ifdef PGM_MAPPED_FILE_MMAP
+    void open(std::filesystem::path const& file_path) {
+        int const fd = ::open(file_path.c_str(), O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        if (fd < 0) {
+            throw SerializationError{std::format("Cannot open file {}!\n", file_path.string())};
+        }
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) != 0) {
+            ::close(fd);
+            throw SerializationError{std::format("Cannot read the size of file {}!\n", file_path.string())};
+        }
+        size_ = static_cast<size_t>(file_stat.st_size);
+        if (size_ == 0) {
+            // an empty file cannot be mapped
+            ::close(fd);
+            return;
+        }
+        void* const mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping stays valid after the file is closed
+        ::close(fd);
+        if (mapping == MAP_FAILED) { // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+            size_ = 0;
+            throw SerializationError{std::format("Cannot map file {} into memory!\n", file_path.string())};
+        }
+        // the advice is only a hint: the mapping is usable even if it is not honored
+        (void)::madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<char const*>(mapping);
+        is_mapped_ = true;
+    }
+
+    void release() {
+        if (is_mapped_) {
+            (void)::munmap(const_cast<char*>(data_), size_); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        }
+        data_ = nullptr;
+        size_ = 0;
+        is_mapped_ = false;
+    }
+#else
+    void open(std::filesystem::path const& file_path) {
+        std::ifstream file{file_path, std::ios::binary | std::ios::ate};
+        if (!file) {
+            throw SerializationError{std::format("Cannot open file {}!\n", file_path.string())};
+        }
+        buffer_.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()))) {
+            throw SerializationError{std::format("Cannot read file {}!\n", file_path.string())};
+        }
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+    }
+
+    void release() {
+        buffer_.clear();
+        data_ = nullptr;
+        size_ = 0;
+    }
+#endif
+};
+
+} // namespace power_grid_model::meta_data
+
+#undef PGM_MAPPED_FILE_MMAP
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// direct decoding of msgpack values with a known type, without visitor dispatch
+
+#include "../../common/common.hpp"
+#include "../../common/three_phase_tensor.hpp"
+#include "../meta_data.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace power_grid_model::meta_data::detail {
+
+// a decoder reads one value at the offset and stores it, advancing the offset
+// only the plain encodings of the value type are decoded: nil (keeps the value), integers and floats
+// anything else, including values out of range and truncated data, is not decoded and the offset stays put,
+//    so that the generic visitor can parse it or report the error
+using AttributeDecoder = bool (*)(char const* data, size_t size, size_t& offset, void* value);
+
+struct MsgpackScalar {
+    enum class Kind : uint8_t { other, nil, positive_integer, negative_integer, float32, float64 };
+
+    Kind kind{Kind::other};
+    uint64_t positive_integer{};
+    int64_t negative_integer{};
+    double floating{};
+    size_t n_bytes{};
+};
+
+template <std::unsigned_integral U> U load_big_endian(char const* data) {
+    U value{};
+    for (size_t i = 0; i != sizeof(U); ++i) {
+        value = static_cast<U>((static_cast<uint64_t>(value) << 8U) | static_cast<unsigned char>(data[i]));
+    }
+    return value;
+}
+
+// decode the scalar at the offset, Kind::other for anything which is not nil or a number
+inline MsgpackScalar decode_scalar(char const* data, size_t size, size_t offset) {
+    using enum MsgpackScalar::Kind;
+
+    if (offset >= size) {
+        return {};
+    }
+    auto const type = static_cast<unsigned char>(data[offset]);
+    char const* const payload = data + offset + 1;
+    size_t const available = size - offset - 1;
+
+    auto const unsigned_value = [available, payload]<std::unsigned_integral U>(U /* tag */) -> MsgpackScalar {
+        if (available < sizeof(U)) {
+            return {};
+        }
+        return {.kind = positive_integer, .positive_integer = load_big_endian<U>(payload), .n_bytes = 1 + sizeof(U)};
+    };
+    // non-negative values of signed encodings are positive integers, the same as in the generic parser
+    auto const signed_value = [available, payload]<std::signed_integral S>(S /* tag */) -> MsgpackScalar {
+        if (available < sizeof(S)) {
+            return {};
+        }
+        auto const value = std::bit_cast<S>(load_big_endian<std::make_unsigned_t<S>>(payload));
+        if (value >= 0) {
+            return {.kind = positive_integer,
+                    .positive_integer = static_cast<uint64_t>(value),
+                    .n_bytes = 1 + sizeof(S)};
+        }
+        return {.kind = negative_integer, .negative_integer = value, .n_bytes = 1 + sizeof(S)};
+    };
+
+    if (type <= 0x7fU) { // positive fixint
+        return {.kind = positive_integer, .positive_integer = type, .n_bytes = 1};
+    }
+    if (type >= 0xe0U) { // negative fixint
+        return {.kind = negative_integer, .negative_integer = static_cast<int8_t>(type), .n_bytes = 1};
+    }
+    switch (type) {
+    case 0xc0U:
+        return {.kind = nil, .n_bytes = 1};
+    case 0xcaU:
+        if (available < sizeof(float)) {
+            return {};
+        }
+        return {.kind = float32,
+                .floating = std::bit_cast<float>(load_big_endian<uint32_t>(payload)),
+                .n_bytes = 1 + sizeof(float)};
+    case 0xcbU:
+        if (available < sizeof(double)) {
+            return {};
+        }
+        return {.kind = float64,
+                .floating = std::bit_cast<double>(load_big_endian<uint64_t>(payload)),
+                .n_bytes = 1 + sizeof(double)};
+    case 0xccU:
+        return unsigned_value(uint8_t{});
+    case 0xcdU:
+        return unsigned_value(uint16_t{});
+    case 0xceU:
+        return unsigned_value(uint32_t{});
+    case 0xcfU:
+        return unsigned_value(uint64_t{});
+    case 0xd0U:
+        return signed_value(int8_t{});
+    case 0xd1U:
+        return signed_value(int16_t{});
+    case 0xd2U:
+        return signed_value(int32_t{});
+    case 0xd3U:
+        return signed_value(int64_t{});
+    default:
+        return {};
+    }
+}
+
+// decode the header of an array with exactly the expected number of elements
+inline bool decode_array_header(char const* data, size_t size, size_t& offset, size_t n_elements) {
+    if (offset >= size) {
+        return false;
+    }
+    auto const type = static_cast<unsigned char>(data[offset]);
+    char const* const payload = data + offset + 1;
+    size_t const available = size - offset - 1;
+    size_t header_size{};
+    size_t array_size{};
+    if ((type & 0xf0U) == 0x90U) { // fixarray
+        header_size = 1;
+        array_size = type & 0x0fU;
+    } else if (type == 0xdcU && available >= sizeof(uint16_t)) {
+        header_size = 1 + sizeof(uint16_t);
+        array_size = load_big_endian<uint16_t>(payload);
+    } else if (type == 0xddU && available >= sizeof(uint32_t)) {
+        header_size = 1 + sizeof(uint32_t);
+        array_size = load_big_endian<uint32_t>(payload);
+    } else {
+        return false;
+    }
+    if (array_size != n_elements) {
+        return false;
+    }
+    offset += header_size;
+    return true;
+}
+
+template <std::integral T> bool decode_value(char const* data, size_t size, size_t& offset, T& value) {
+    using enum MsgpackScalar::Kind;
+
+    MsgpackScalar const scalar = decode_scalar(data, size, offset);
+    switch (scalar.kind) {
+    case nil:
+        break;
+    case positive_integer:
+        if (!std::in_range<T>(scalar.positive_integer)) {
+            return false;
+        }
+        value = static_cast<T>(scalar.positive_integer);
+        break;
+    case negative_integer:
+        if (!std::in_range<T>(scalar.negative_integer)) {
+            return false;
+        }
+        value = static_cast<T>(scalar.negative_integer);
+        break;
+    default:
+        return false;
+    }
+    offset += scalar.n_bytes;
+    return true;
+}
+
+inline bool decode_value(char const* data, size_t size, size_t& offset, double& value) {
+    using enum MsgpackScalar::Kind;
+
+    MsgpackScalar const scalar = decode_scalar(data, size, offset);
+    switch (scalar.kind) {
+    case nil:
+        break;
+    case positive_integer:
+        value = static_cast<double>(scalar.positive_integer);
+        break;
+    case negative_integer:
+        value = static_cast<double>(scalar.negative_integer);
+        break;
+    case float32:
+        [[fallthrough]];
+    case float64:
+        value = scalar.floating;
+        break;
+    default:
+        return false;
+    }
+    offset += scalar.n_bytes;
+    return true;
+}
+
+// nil, or a fixed array of 3 numbers or nil
+inline bool decode_value(char const* data, size_t size, size_t& offset, RealValue<asymmetric_t>& value) {
+    constexpr unsigned char fixarray_3 = 0x93U;
+
+    if (offset >= size) {
+        return false;
+    }
+    auto const type = static_cast<unsigned char>(data[offset]);
+    if (type == 0xc0U) {
+        ++offset;
+        return true;
+    }
+    if (type != fixarray_3) {
+        return false;
+    }
+    size_t element_offset = offset + 1;
+    RealValue<asymmetric_t> decoded{value};
+    for (Idx phase = 0; phase != 3; ++phase) {
+        if (!decode_value(data, size, element_offset, decoded(phase))) {
+            return false;
+        }
+    }
+    value = decoded;
+    offset = element_offset;
+    return true;
+}
+
+template <class T> bool decode_attribute(char const* data, size_t size, size_t& offset, void* value) {
+    return decode_value(data, size, offset, *static_cast<T*>(value));
+}
+
+// one decoder per attribute of a compact list, in the order of the list
+inline std::vector<AttributeDecoder> attribute_decode_plan(std::span<MetaAttribute const* const> attributes) {
+    std::vector<AttributeDecoder> plan(attributes.size());
+    std::ranges::transform(attributes, plan.begin(), [](MetaAttribute const* attribute) {
+        return ctype_func_selector(attribute->ctype,
+                                   []<class T>() -> AttributeDecoder { return &decode_attribute<T>; });
+    });
+    return plan;
+}
+
+} // namespace power_grid_model::meta_data::detail
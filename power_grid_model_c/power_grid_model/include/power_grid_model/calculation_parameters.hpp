@@ -10,6 +10,8 @@
 #include "common/statistics.hpp"
 #include "common/three_phase_tensor.hpp"
 
+#include <numeric>
+
 namespace power_grid_model {
 
 // Entry of YBus, node addmittance matrix
@@ -215,6 +217,13 @@ struct MathModelParamIncrement {
     std::vector<Idx> shunt_param_to_change;  // indices of changed shunt_param
 };
 
+template <symmetry_tag sym_type> struct MathModelParamUpdate {
+    using sym = sym_type;
+
+    std::vector<BranchCalcParam<sym>> branch_param; // new values of changed branch_param, see branch_param_to_change
+    ComplexTensorVector<sym> shunt_param;           // new values of changed shunt_param, see shunt_param_to_change
+};
+
 template <symmetry_tag sym_type> struct PowerFlowInput {
     using sym = sym_type;
 
@@ -407,6 +416,48 @@ struct Idx2DBranch3 {
     friend constexpr bool operator==(Idx2DBranch3 const& x, Idx2DBranch3 const& y) = default;
 };
 
+// flat coupling of the components of one type to the math models, precomputed once per topology
+// only the components coupled to a math model are included, grouped per math model
+//		the components of math model i are at [math_model_indptr[i], math_model_indptr[i + 1])
+//		component_seq = sequence number of the component
+//		math_pos = sequence number in the math model
+// so that the calculation input can be gathered per math model without branching on isolated components
+struct FlatComponentToMathCoupling {
+    IdxVector math_model_indptr{0};
+    IdxVector component_seq;
+    IdxVector math_pos;
+
+    Idx n_math_model() const { return std::ssize(math_model_indptr) - 1; }
+};
+
+// math model group of a component which is not in any math model
+constexpr Idx isolated_component{-1};
+
+// flatten an Idx2D coupling for n_math_model math models
+// the components keep their sequence order within each math model
+inline FlatComponentToMathCoupling flatten_coupling(std::vector<Idx2D> const& coupling, Idx n_math_model) {
+    FlatComponentToMathCoupling flat{.math_model_indptr = IdxVector(n_math_model + 1, 0), .component_seq = {},
+                                     .math_pos = {}};
+    for (Idx2D const& math_idx : coupling) {
+        if (math_idx.group != isolated_component) {
+            ++flat.math_model_indptr[math_idx.group + 1];
+        }
+    }
+    std::partial_sum(flat.math_model_indptr.cbegin(), flat.math_model_indptr.cend(), flat.math_model_indptr.begin());
+    flat.component_seq.resize(flat.math_model_indptr.back());
+    flat.math_pos.resize(flat.math_model_indptr.back());
+    IdxVector next_position{flat.math_model_indptr.cbegin(), flat.math_model_indptr.cend() - 1};
+    for (Idx seq = 0; seq != std::ssize(coupling); ++seq) {
+        Idx2D const& math_idx = coupling[seq];
+        if (math_idx.group != isolated_component) {
+            Idx const position = next_position[math_idx.group]++;
+            flat.component_seq[position] = seq;
+            flat.math_pos[position] = math_idx.pos;
+        }
+    }
+    return flat;
+}
+
 // couple component to math model
 // use Idx2D to map component to math model
 //		group = math model sequence number,
@@ -435,6 +486,14 @@ struct TopologicalComponentToMathCoupling {
     std::vector<Idx2D> power_sensor;   // can be coupled to branch-from/to, source, load_gen, or shunt sensor
     std::vector<Idx2D> current_sensor; // can be coupled to branch-from/to
     std::vector<Idx2D> regulator;
+
+    // flat couplings of the appliances and sensors for the preparation of the calculation input
+    FlatComponentToMathCoupling flat_shunt;
+    FlatComponentToMathCoupling flat_load_gen;
+    FlatComponentToMathCoupling flat_source;
+    FlatComponentToMathCoupling flat_voltage_sensor;
+    FlatComponentToMathCoupling flat_power_sensor;
+    FlatComponentToMathCoupling flat_current_sensor;
 };
 
 } // namespace power_grid_model
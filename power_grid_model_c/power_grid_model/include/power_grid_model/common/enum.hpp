@@ -107,6 +107,15 @@ enum class CType : IntS { c_int32 = 0, c_int8 = 1, c_double = 2, c_double3 = 3 }
 
 enum class SerializationFormat : IntS { json = 0, msgpack = 1 };
 
+enum class ArrowIpcFormat : IntS { stream = 0, file = 1 };
+
+enum class ValidationErrorType : IntS {
+    missing_value = 0,     // a required attribute is nan
+    not_unique = 1,        // the id is used by more than one element
+    invalid_reference = 2, // the referenced id does not exist in the components which can be referenced
+    out_of_range = 3,      // the value is not within the valid range of the attribute
+};
+
 enum class OptimizerType : IntS {
     no_optimization = 0,          // do nothing
     automatic_tap_adjustment = 1, // power flow with automatic tap adjustment
@@ -126,6 +135,11 @@ enum class SearchMethod : IntS { // Which type of tap search method for finite e
     binary_search = 1,           // use binary search: half a tap range at a time
 };
 
+enum class ThreadAffinity : IntS { // Placement of batch worker threads
+    none = 0,                       // none = leave thread placement to the operating system
+    pinned = 1,                     // pinned = pin each worker thread to its own core
+};
+
 enum class AngleMeasurementType : IntS { // The type of the angle measurement for current sensors
     local_angle = 0,                     // local_angle = 0, the angle is relative to the local voltage angle
     global_angle = 1,                    // global_angle = 1, the angle is relative to the global voltage angle
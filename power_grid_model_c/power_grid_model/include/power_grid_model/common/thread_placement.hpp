@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// placement of (batch) worker threads on the hardware
+
+#include "common.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace power_grid_model {
+
+struct ThreadPlacement {
+    Idx cpu{-1};       // logical core the thread is running on, -1 if unknown
+    Idx numa_node{-1}; // NUMA node of that core, -1 if unknown
+    bool pinned{false};
+};
+
+#if defined(__linux__)
+
+// placement of the calling thread at this moment
+inline ThreadPlacement current_thread_placement() {
+    unsigned cpu{};
+    unsigned node{};
+    // call getcpu through syscall to support glibc versions without the wrapper
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return {};
+    }
+    return {.cpu = static_cast<Idx>(cpu), .numa_node = static_cast<Idx>(node)};
+}
+
+// pin the calling thread to the n-th core of the cores this process is allowed to run on
+// the cores are used round robin if n exceeds the number of allowed cores
+// memory touched first by the thread after pinning is allocated on the NUMA node of that core
+inline ThreadPlacement pin_current_thread(Idx n) {
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return current_thread_placement();
+    }
+    Idx const n_allowed = CPU_COUNT(&allowed);
+    if (n_allowed == 0) {
+        return current_thread_placement();
+    }
+    Idx const target = n % n_allowed;
+    for (Idx cpu = 0, found = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (!CPU_ISSET(cpu, &allowed)) {
+            continue;
+        }
+        if (found++ == target) {
+            cpu_set_t pinned;
+            CPU_ZERO(&pinned);
+            CPU_SET(cpu, &pinned);
+            if (pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned) != 0) {
+                break;
+            }
+            // the scheduler migrates the thread at the latest when it is rescheduled
+            sched_yield();
+            auto placement = current_thread_placement();
+            placement.pinned = true;
+            return placement;
+        }
+    }
+    return current_thread_placement();
+}
+
+#else // !defined(__linux__)
+
+// thread placement is not supported on this platform
+inline ThreadPlacement current_thread_placement() { return {}; }
+inline ThreadPlacement pin_current_thread(Idx /* n */) { return {}; }
+
+#endif // defined(__linux__)
+
+} // namespace power_grid_model
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// distribution of independent tasks over threads
+//
+// all parallel functions (batch calculation, output, dataset conversion, set nan, deserialization and validation)
+// take the same threading argument
+//    < 0 sequential
+//    = 0 use the number of hardware threads
+//    > 0 specified number of threads
+// the tasks run sequentially in the calling thread if
+//    the hardware threads are used, but their number is either unknown (0) or one (1)
+//    the specified number of threads is one
+//    there are less than two tasks
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <thread>
+#include <vector>
+
+namespace power_grid_model {
+
+// number of threads to run n_tasks independent tasks with, never more threads than tasks
+inline Idx get_n_threads(Idx threading, Idx n_tasks) {
+    auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
+    if (threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2) || n_tasks < 2) {
+        return 1;
+    }
+    return std::min(threading == 0 ? hardware_thread : threading, n_tasks);
+}
+
+// call thread_fn(thread_number) for every thread_number in [0, n_thread) in its own thread and wait for all of them
+// a single thread_fn is called in the calling thread
+template <std::invocable<Idx> ThreadFn> void run_in_threads(Idx n_thread, ThreadFn const& thread_fn) {
+    if (n_thread <= 1) {
+        thread_fn(Idx{0});
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(n_thread);
+    for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
+        threads.emplace_back([&thread_fn, thread_number] { thread_fn(thread_number); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace power_grid_model
@@ -20,7 +20,7 @@
 
 namespace power_grid_model {
 
-class AsymLine : public Branch {
+class AsymLine final : public Branch {
   public:
     using InputType = AsymLineInput;
     using UpdateType = BranchUpdate;
@@ -91,6 +91,7 @@ class AsymLine : public Branch {
         return c_matrix;
     }
 
+    friend class Branch;
     BranchCalcParam<symmetric_t> sym_calc_param() const override final {
         DoubleComplex y1_series =
             average_of_diagonal_of_matrix(y_series_abc_) - average_of_off_diagonal_of_matrix(y_series_abc_);
@@ -14,6 +14,8 @@
 #include "../common/exception.hpp"
 #include "../common/three_phase_tensor.hpp"
 
+#include <concepts>
+
 namespace power_grid_model {
 
 class Branch : public Base {
@@ -64,14 +66,17 @@ class Branch : public Base {
             throw MissingCaseForEnumError{"status(BranchSide)", side};
         }
     }
-    template <symmetry_tag sym> BranchCalcParam<sym> calc_param(bool is_connected_to_source = true) const {
+    // the concrete (final) branch type can be given to resolve the calculation statically instead of virtually
+    template <symmetry_tag sym, std::derived_from<Branch> BranchType = Branch>
+    BranchCalcParam<sym> calc_param(bool is_connected_to_source = true) const {
         if (!energized(is_connected_to_source)) {
             return BranchCalcParam<sym>{};
         }
+        auto const& branch = static_cast<BranchType const&>(*this);
         if constexpr (is_symmetric_v<sym>) {
-            return sym_calc_param();
+            return branch.sym_calc_param();
         } else {
-            return asym_calc_param();
+            return branch.asym_calc_param();
         }
     }
 
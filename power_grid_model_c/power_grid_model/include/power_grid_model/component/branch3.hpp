@@ -12,6 +12,8 @@
 #include "../calculation_parameters.hpp"
 #include "../common/exception.hpp"
 
+#include <concepts>
+
 namespace power_grid_model {
 
 class Branch3 : public Base {
@@ -87,15 +89,17 @@ class Branch3 : public Base {
     virtual double loading(double s_1, double s_2, double s_3) const = 0;
     virtual std::array<double, 3> phase_shift() const = 0;
 
-    template <symmetry_tag sym>
+    // the concrete (final) branch3 type can be given to resolve the calculation statically instead of virtually
+    template <symmetry_tag sym, std::derived_from<Branch3> Branch3Type = Branch3>
     std::array<BranchCalcParam<sym>, 3> calc_param(bool is_connected_to_source = true) const {
         if (!energized(is_connected_to_source)) {
             return std::array<BranchCalcParam<sym>, 3>{};
         }
+        auto const& branch3 = static_cast<Branch3Type const&>(*this);
         if constexpr (is_symmetric_v<sym>) {
-            return sym_calc_param();
+            return branch3.sym_calc_param();
         } else {
-            return asym_calc_param();
+            return branch3.asym_calc_param();
         }
     }
 
@@ -73,6 +73,7 @@ class GenericBranch final : public Branch {
     DoubleComplex y1_series_;
     DoubleComplex y1_shunt_;
 
+    friend class Branch;
     BranchCalcParam<symmetric_t> sym_calc_param() const override {
         return calc_param_y_sym(y1_series_, y1_shunt_, k_ * std::exp(1.0i * theta_));
     }
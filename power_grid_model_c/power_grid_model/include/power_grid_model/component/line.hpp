@@ -49,6 +49,7 @@ class Line final : public Branch {
     DoubleComplex y0_series_;
     DoubleComplex y0_shunt_;
 
+    friend class Branch;
     BranchCalcParam<symmetric_t> sym_calc_param() const override {
         return calc_param_y_sym(y1_series_, y1_shunt_, 1.0);
     }
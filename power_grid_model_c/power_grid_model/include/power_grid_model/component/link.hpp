@@ -35,6 +35,7 @@ class Link final : public Branch {
   private:
     double base_i_from_;
     double base_i_to_;
+    friend class Branch;
     BranchCalcParam<symmetric_t> sym_calc_param() const override { return calc_param_y_sym(y_link, 0.0, 1.0); }
     BranchCalcParam<asymmetric_t> asym_calc_param() const override {
         return calc_param_y_asym(y_link, 0.0, y_link, 0.0, 1.0);
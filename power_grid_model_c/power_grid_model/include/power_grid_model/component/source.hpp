@@ -16,7 +16,7 @@
 
 namespace power_grid_model {
 
-class Source : public Appliance {
+class Source final : public Appliance {
   public:
     using InputType = SourceInput;
     using UpdateType = SourceUpdate;
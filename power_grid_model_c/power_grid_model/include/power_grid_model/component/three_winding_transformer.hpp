@@ -10,7 +10,7 @@
 
 namespace power_grid_model {
 
-class ThreeWindingTransformer : public Branch3 {
+class ThreeWindingTransformer final : public Branch3 {
   public:
     using InputType = ThreeWindingTransformerInput;
     using UpdateType = ThreeWindingTransformerUpdate;
@@ -397,12 +397,13 @@ class ThreeWindingTransformer : public Branch3 {
         return {T1, T2, T3};
     }
 
+    friend class Branch3;
     // calculate branch parameters
     std::array<BranchCalcParam<symmetric_t>, 3> sym_calc_param() const final {
         std::array<Transformer, 3> const transformer_array = convert_to_two_winding_transformers();
         std::array<BranchCalcParam<symmetric_t>, 3> transformer_params{};
         for (size_t i = 0; i < transformer_array.size(); i++) {
-            transformer_params[i] = transformer_array[i].calc_param<symmetric_t>();
+            transformer_params[i] = transformer_array[i].calc_param<symmetric_t, Transformer>();
         }
         return transformer_params;
     }
@@ -410,7 +411,7 @@ class ThreeWindingTransformer : public Branch3 {
         std::array<Transformer, 3> const transformer_array = convert_to_two_winding_transformers();
         std::array<BranchCalcParam<asymmetric_t>, 3> transformer_params{};
         for (size_t i = 0; i < transformer_array.size(); i++) {
-            transformer_params[i] = transformer_array[i].calc_param<asymmetric_t>();
+            transformer_params[i] = transformer_array[i].calc_param<asymmetric_t, Transformer>();
         }
         return transformer_params;
     }
@@ -17,7 +17,7 @@
 
 namespace power_grid_model {
 
-class Transformer : public Branch {
+class Transformer final : public Branch {
   public:
     using InputType = TransformerInput;
     using UpdateType = TransformerUpdate;
@@ -207,6 +207,7 @@ class Transformer : public Branch {
         return std::make_tuple(y_series, y_shunt, k);
     }
 
+    friend class Branch;
     // branch param
     BranchCalcParam<symmetric_t> sym_calc_param() const final {
         auto const [y_series, y_shunt, k] = transformer_params();
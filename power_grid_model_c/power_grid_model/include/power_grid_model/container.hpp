@@ -335,6 +335,12 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
                                      Iterator<Gettable const>{this, this->template size<std::remove_cv_t<Gettable>>()}};
     }
     template <supported_type_c<GettableTypes...> Gettable> auto citer() const { return iter<Gettable>(); }
+
+    // get all items of one storage type as a contiguous range
+    // the sequence index of the first item in the range of a base type is given by get_start_idx
+    template <supported_type_c<StorageableTypes...> Storageable> std::span<Storageable const> citer_storage() const {
+        return std::get<std::vector<Storageable>>(vectors_);
+    }
 };
 
 // type traits to instantiate container
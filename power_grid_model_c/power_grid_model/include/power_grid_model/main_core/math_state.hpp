@@ -16,6 +16,53 @@ struct MathState {
     std::vector<MathSolverProxy<asymmetric_t>> math_solvers_asym;
 };
 
+// calculation input of all math models, reused by consecutive calculations (e.g. the scenarios of a batch) of the same
+// model instance, so that the vectors keep their capacity and are not reallocated for every calculation
+// the buffers are scratch memory and not part of the model state: a copy of a model starts with empty buffers
+class CalculationInputBuffers {
+  public:
+    CalculationInputBuffers() = default;
+    CalculationInputBuffers(CalculationInputBuffers const& /* other */) {}
+    CalculationInputBuffers(CalculationInputBuffers&&) noexcept = default;
+    CalculationInputBuffers& operator=(CalculationInputBuffers const& other) {
+        if (this != &other) {
+            clear();
+        }
+        return *this;
+    }
+    CalculationInputBuffers& operator=(CalculationInputBuffers&&) noexcept = default;
+    ~CalculationInputBuffers() = default;
+
+    template <symmetry_tag sym> std::vector<PowerFlowInput<sym>>& power_flow() {
+        if constexpr (is_symmetric_v<sym>) {
+            return power_flow_sym_;
+        } else {
+            return power_flow_asym_;
+        }
+    }
+
+    template <symmetry_tag sym> std::vector<StateEstimationInput<sym>>& state_estimation() {
+        if constexpr (is_symmetric_v<sym>) {
+            return state_estimation_sym_;
+        } else {
+            return state_estimation_asym_;
+        }
+    }
+
+    void clear() {
+        power_flow_sym_.clear();
+        power_flow_asym_.clear();
+        state_estimation_sym_.clear();
+        state_estimation_asym_.clear();
+    }
+
+  private:
+    std::vector<PowerFlowInput<symmetric_t>> power_flow_sym_;
+    std::vector<PowerFlowInput<asymmetric_t>> power_flow_asym_;
+    std::vector<StateEstimationInput<symmetric_t>> state_estimation_sym_;
+    std::vector<StateEstimationInput<asymmetric_t>> state_estimation_asym_;
+};
+
 inline void clear(MathState& math_state) {
     math_state.math_solvers_sym.clear();
     math_state.math_solvers_asym.clear();
@@ -36,13 +83,13 @@ inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>>
     assert(y_bus_vec.size() == math_model_params.size());
 
     for (Idx i = 0; i != static_cast<Idx>(y_bus_vec.size()); ++i) {
-        y_bus_vec[i].update_admittance(std::make_shared<MathModelParam<sym> const>(std::move(math_model_params[i])));
+        y_bus_vec[i].update_admittance(math_model_params[i]);
     }
 }
 
 template <symmetry_tag sym>
-inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>> const& math_model_params,
-                         std::vector<MathModelParamIncrement> const& math_model_param_increments) {
+inline void update_y_bus(MathState& math_state, std::vector<MathModelParamIncrement> const& math_model_param_increments,
+                         std::vector<MathModelParamUpdate<sym>> const& math_model_param_updates) {
     auto& y_bus_vec = [&math_state]() -> auto& {
         if constexpr (is_symmetric_v<sym>) {
             return math_state.y_bus_vec_sym;
@@ -51,12 +98,11 @@ inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>>
         }
     }();
 
-    assert(y_bus_vec.size() == math_model_params.size());
+    assert(y_bus_vec.size() == math_model_param_increments.size());
+    assert(y_bus_vec.size() == math_model_param_updates.size());
 
     for (Idx i = 0; i != static_cast<Idx>(y_bus_vec.size()); ++i) {
-        y_bus_vec[i].update_admittance_increment(
-            std::make_shared<MathModelParam<sym> const>(std::move(math_model_params[i])),
-            math_model_param_increments[i]);
+        y_bus_vec[i].update_admittance_increment(math_model_param_increments[i], math_model_param_updates[i]);
     }
 }
 
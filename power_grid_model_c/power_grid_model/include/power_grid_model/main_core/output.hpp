@@ -85,6 +85,13 @@ constexpr auto comp_base_sequence_cbegin(MainModelState<ComponentContainer> cons
     return state.comp_topo->regulated_object_idx.cbegin() + get_component_sequence_offset<Regulator, Component>(state);
 }
 
+// range [begin, end) of the components of one type to produce output for, by default all components
+// the output iterator points to the output of the first component in the range
+struct OutputRange {
+    Idx begin{0};
+    Idx end{std::numeric_limits<Idx>::max()};
+};
+
 template <typename Component, typename IndexType, class ComponentContainer, typename ResIt, typename ResFunc>
     requires model_component_state_c<MainModelState, ComponentContainer, Component> &&
              std::invocable<std::remove_cvref_t<ResFunc>, Component const&, IndexType> &&
@@ -92,9 +99,15 @@ template <typename Component, typename IndexType, class ComponentContainer, type
                            std::add_lvalue_reference_t<std::iter_value_t<ResIt>>> &&
              std::convertible_to<IndexType,
                                  decltype(*comp_base_sequence_cbegin<Component>(MainModelState<ComponentContainer>{}))>
-constexpr ResIt produce_output(MainModelState<ComponentContainer> const& state, ResIt res_it, ResFunc&& func) {
-    return std::transform(get_component_citer<Component>(state).begin(), get_component_citer<Component>(state).end(),
-                          comp_base_sequence_cbegin<Component>(state), std::move(res_it), std::forward<ResFunc>(func));
+constexpr ResIt produce_output(MainModelState<ComponentContainer> const& state, ResIt res_it, ResFunc&& func,
+                               OutputRange range = {}) {
+    auto const components = get_component_citer<Component>(state);
+    Idx const begin = range.begin;
+    Idx const end = std::min(range.end, narrow_cast<Idx>(std::ranges::distance(components)));
+    assert(0 <= begin && begin <= end);
+    return std::transform(components.begin() + begin, components.begin() + end,
+                          comp_base_sequence_cbegin<Component>(state) + begin, std::move(res_it),
+                          std::forward<ResFunc>(func));
 }
 
 } // namespace detail
@@ -447,11 +460,14 @@ template <std::derived_from<Base> Component, class ComponentContainer, solver_ou
                  } -> detail::assignable_to<std::add_lvalue_reference_t<std::iter_value_t<ResIt>>>;
              }
 constexpr ResIt output_result(MainModelState<ComponentContainer> const& state,
-                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it) {
+                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it,
+                              detail::OutputRange range = {}) {
     return detail::produce_output<Component, Idx2D>(
-        state, res_it, [&math_output](Component const& component, Idx2D math_id) {
+        state, res_it,
+        [&math_output](Component const& component, Idx2D math_id) {
             return output_result<Component>(component, math_output.solver_output, math_id);
-        });
+        },
+        range);
 }
 template <std::derived_from<Base> Component, class ComponentContainer, solver_output_type SolverOutputType,
           typename ResIt>
@@ -463,11 +479,14 @@ template <std::derived_from<Base> Component, class ComponentContainer, solver_ou
                  } -> detail::assignable_to<std::add_lvalue_reference_t<std::iter_value_t<ResIt>>>;
              }
 constexpr ResIt output_result(MainModelState<ComponentContainer> const& state,
-                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it) {
+                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it,
+                              detail::OutputRange range = {}) {
     return detail::produce_output<Component, Idx2D>(
-        state, res_it, [&state, &math_output](Component const& component, Idx2D const math_id) {
+        state, res_it,
+        [&state, &math_output](Component const& component, Idx2D const math_id) {
             return output_result<Component>(component, state, math_output.solver_output, math_id);
-        });
+        },
+        range);
 }
 template <std::derived_from<Base> Component, class ComponentContainer, solver_output_type SolverOutputType,
           typename ResIt>
@@ -479,11 +498,14 @@ template <std::derived_from<Base> Component, class ComponentContainer, solver_ou
                  } -> detail::assignable_to<std::add_lvalue_reference_t<std::iter_value_t<ResIt>>>;
              }
 constexpr ResIt output_result(MainModelState<ComponentContainer> const& state,
-                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it) {
+                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it,
+                              detail::OutputRange range = {}) {
     return detail::produce_output<Component, Idx>(
-        state, res_it, [&state, &math_output](Component const& component, Idx const obj_seq) {
+        state, res_it,
+        [&state, &math_output](Component const& component, Idx const obj_seq) {
             return output_result<Component, ComponentContainer>(component, state, math_output.solver_output, obj_seq);
-        });
+        },
+        range);
 }
 template <std::derived_from<Base> Component, class ComponentContainer, solver_output_type SolverOutputType,
           typename ResIt>
@@ -495,11 +517,14 @@ template <std::derived_from<Base> Component, class ComponentContainer, solver_ou
                  } -> detail::assignable_to<std::add_lvalue_reference_t<std::iter_value_t<ResIt>>>;
              }
 constexpr ResIt output_result(MainModelState<ComponentContainer> const& state,
-                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it) {
+                              MathOutput<std::vector<SolverOutputType>> const& math_output, ResIt res_it,
+                              detail::OutputRange range = {}) {
     return detail::produce_output<Component, Idx2DBranch3>(
-        state, res_it, [&math_output](Component const& component, Idx2DBranch3 const& math_id) {
+        state, res_it,
+        [&math_output](Component const& component, Idx2DBranch3 const& math_id) {
             return output_result<Component>(component, math_output.solver_output, math_id);
-        });
+        },
+        range);
 }
 template <std::derived_from<Base> Component, class ComponentContainer, typename SolverOutputType, typename ResIt>
     requires model_component_state_c<MainModelState, ComponentContainer, Component> &&
@@ -510,11 +535,14 @@ template <std::derived_from<Base> Component, class ComponentContainer, typename
                  } -> detail::assignable_to<std::add_lvalue_reference_t<std::iter_value_t<ResIt>>>;
              }
 constexpr ResIt output_result(MainModelState<ComponentContainer> const& state,
-                              MathOutput<SolverOutputType> const& math_output, ResIt res_it) {
+                              MathOutput<SolverOutputType> const& math_output, ResIt res_it,
+                              detail::OutputRange range = {}) {
     return detail::produce_output<Component, Idx>(
-        state, std::move(res_it), [&state, &math_output](Component const& component, Idx const obj_seq) {
+        state, std::move(res_it),
+        [&state, &math_output](Component const& component, Idx const obj_seq) {
             return output_result<Component, ComponentContainer>(component, state, math_output, obj_seq);
-        });
+        },
+        range);
 }
 
 // output source, load_gen, shunt individually
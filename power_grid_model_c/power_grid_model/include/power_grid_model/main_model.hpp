@@ -11,31 +11,35 @@
 namespace power_grid_model {
 
 // main model class
+// the model can be instantiated with a subset of all components to reduce the per-scenario overhead and binary size
+// Shunt and Fault are always retrievable, because the topology and short circuit input preparation look them up
 
-class MainModel {
+template <class ModelComponents> class BasicMainModel {
   private:
+    static_assert(IsInList<Node, ModelComponents>::value, "A model cannot be built without nodes");
+
     using Impl = MainModelImpl<
         ExtraRetrievableTypes<Base, Node, Branch, Branch3, Appliance, GenericLoadGen, GenericLoad, GenericGenerator,
-                              GenericPowerSensor, GenericVoltageSensor, GenericCurrentSensor, Regulator>,
-        AllComponents>;
+                              GenericPowerSensor, GenericVoltageSensor, GenericCurrentSensor, Regulator, Shunt, Fault>,
+        ModelComponents>;
 
   public:
     using Options = MainModelOptions;
 
-    explicit MainModel(double system_frequency, ConstDataset const& input_data,
-                       MathSolverDispatcher const& math_solver_dispatcher, Idx pos = 0)
+    explicit BasicMainModel(double system_frequency, ConstDataset const& input_data,
+                            MathSolverDispatcher const& math_solver_dispatcher, Idx pos = 0)
         : impl_{std::make_unique<Impl>(system_frequency, input_data, math_solver_dispatcher, pos)} {}
-    explicit MainModel(double system_frequency, meta_data::MetaData const& meta_data,
-                       MathSolverDispatcher const& math_solver_dispatcher)
+    explicit BasicMainModel(double system_frequency, meta_data::MetaData const& meta_data,
+                            MathSolverDispatcher const& math_solver_dispatcher)
         : impl_{std::make_unique<Impl>(system_frequency, meta_data, math_solver_dispatcher)} {};
 
     // deep copy
-    MainModel(MainModel const& other) {
+    BasicMainModel(BasicMainModel const& other) {
         if (other.impl_ != nullptr) {
             impl_ = std::make_unique<Impl>(*other.impl_);
         }
     }
-    MainModel& operator=(MainModel const& other) {
+    BasicMainModel& operator=(BasicMainModel const& other) {
         if (this != &other) {
             impl_.reset();
             if (other.impl_ != nullptr) {
@@ -44,21 +48,21 @@ class MainModel {
         }
         return *this;
     }
-    MainModel(MainModel&& other) noexcept : impl_{std::move(other.impl_)} {}
-    MainModel& operator=(MainModel&& other) noexcept {
+    BasicMainModel(BasicMainModel&& other) noexcept : impl_{std::move(other.impl_)} {}
+    BasicMainModel& operator=(BasicMainModel&& other) noexcept {
         if (this != &other) {
             impl_ = std::move(other.impl_);
         }
         return *this;
     };
-    ~MainModel() { impl_.reset(); }
+    ~BasicMainModel() { impl_.reset(); }
 
     void get_indexer(std::string_view component_type, ID const* id_begin, Idx size, Idx* indexer_begin) const {
         impl().get_indexer(component_type, id_begin, size, indexer_begin);
     }
 
     template <cache_type_c CacheType> void update_components(ConstDataset const& update_data) {
-        impl().update_components<CacheType>(update_data.get_individual_scenario(0));
+        impl().template update_components<CacheType>(update_data.get_individual_scenario(0));
     }
 
     BatchParameter calculate(Options const& options, MutableDataset const& result_data,
@@ -85,4 +89,9 @@ class MainModel {
     std::unique_ptr<Impl> impl_;
 };
 
+using MainModel = BasicMainModel<AllComponents>;
+
+// model with a user-selected component set, e.g. TrimmedMainModel<Node, Line, Transformer, SymLoad, Source>
+template <class... ComponentType> using TrimmedMainModel = BasicMainModel<ComponentList<ComponentType...>>;
+
 } // namespace power_grid_model
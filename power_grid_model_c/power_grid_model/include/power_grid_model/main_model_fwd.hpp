@@ -26,6 +26,7 @@ struct MainModelOptions {
     double err_tol{1e-8};
     Idx max_iter{20};
     Idx threading{sequential};
+    ThreadAffinity thread_affinity{ThreadAffinity::none};
 
     ShortCircuitVoltageScaling short_circuit_voltage_scaling{ShortCircuitVoltageScaling::maximum};
 };
@@ -16,6 +16,8 @@
 // common
 #include "common/common.hpp"
 #include "common/exception.hpp"
+#include "common/thread_placement.hpp"
+#include "common/threading.hpp"
 #include "common/timer.hpp"
 
 // component include
@@ -39,6 +41,8 @@
 #include "main_core/update.hpp"
 
 // stl library
+#include <exception>
+#include <functional>
 #include <memory>
 #include <span>
 #include <thread>
@@ -153,7 +157,6 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     using OwnedUpdateDataset = std::tuple<std::vector<typename ComponentType::UpdateType>...>;
 
     static constexpr Idx ignore_output{-1};
-    static constexpr Idx isolated_component{-1};
     static constexpr Idx not_connected{-1};
     static constexpr Idx sequential{-1};
 
@@ -167,6 +170,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
           meta_data_{&input_data.meta_data()},
           math_solver_dispatcher_{&math_solver_dispatcher} {
         assert(input_data.get_description().dataset->name == std::string_view("input"));
+        check_supported_components(input_data);
         add_components(input_data, pos);
         set_construction_complete();
     }
@@ -179,6 +183,18 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
           math_solver_dispatcher_{&math_solver_dispatcher} {}
 
   private:
+    // a model can be instantiated with a subset of all components
+    // data of components outside that subset would be silently ignored, so reject it instead
+    static void check_supported_components(ConstDataset const& data) {
+        for (Idx i = 0; i != data.n_components(); ++i) {
+            auto const& component_info = data.get_component_info(i);
+            std::string_view const component_name = component_info.component->name;
+            if (component_info.total_elements != 0 && ((component_name != ComponentType::name) && ...)) {
+                throw DatasetError{std::format("Component '{}' is not supported by this model!\n", component_name)};
+            }
+        }
+    }
+
     // helper function to get what components are present in the update data
     std::array<bool, main_core::utils::n_types<ComponentType...>>
     get_components_to_update(ConstDataset const& update_data) const {
@@ -301,6 +317,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
   public:
     // overload to update all components in the first scenario (e.g. permanent update)
     template <cache_type_c CacheType> void update_components(ConstDataset const& update_data) {
+        check_supported_components(update_data);
         auto const components_to_update = get_components_to_update(update_data);
         auto const update_independence =
             main_core::update::independence::check_update_independence<ComponentType...>(state_, update_data);
@@ -415,7 +432,8 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
               typename PrepareInputFn, typename SolveFn>
         requires std::invocable<std::remove_cvref_t<PrepareInputFn>, Idx /*n_math_solvers*/> &&
                  std::invocable<std::remove_cvref_t<SolveFn>, MathSolverType&, YBus const&, InputType const&> &&
-                 std::same_as<std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>, std::vector<InputType>> &&
+                 std::convertible_to<std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>,
+                                     std::vector<InputType> const&> &&
                  std::same_as<std::invoke_result_t<SolveFn, MathSolverType&, YBus const&, InputType const&>,
                               SolverOutputType>
     std::vector<SolverOutputType> calculate_(PrepareInputFn&& prepare_input, SolveFn&& solve) {
@@ -424,7 +442,8 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         assert(construction_complete_);
         calculation_info_ = CalculationInfo{};
         // prepare
-        auto const& input = [this, prepare_input_ = std::forward<PrepareInputFn>(prepare_input)] {
+        // the input may refer to the reusable input buffers of this model
+        auto const& input = [this, prepare_input_ = std::forward<PrepareInputFn>(prepare_input)]() -> decltype(auto) {
             Timer const timer(calculation_info_, 2100, "Prepare");
             prepare_solvers<sym>();
             assert(is_topology_up_to_date_ && is_parameter_up_to_date<sym>());
@@ -448,7 +467,10 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         return [this, err_tol, max_iter](MainModelState const& state,
                                          CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
             return calculate_<SolverOutput<sym>, MathSolverProxy<sym>, YBus<sym>, PowerFlowInput<sym>>(
-                [&state](Idx n_math_solvers) { return prepare_power_flow_input<sym>(state, n_math_solvers); },
+                [this, &state](Idx n_math_solvers) -> auto const& {
+                    return prepare_power_flow_input<sym>(state, n_math_solvers,
+                                                         calc_input_buffers_.template power_flow<sym>());
+                },
                 [this, err_tol, max_iter, calculation_method](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
                                                               PowerFlowInput<sym> const& input) {
                     return solver.get().run_power_flow(input, err_tol, max_iter, calculation_info_, calculation_method,
@@ -461,7 +483,10 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         return [this, err_tol, max_iter](MainModelState const& state,
                                          CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
             return calculate_<SolverOutput<sym>, MathSolverProxy<sym>, YBus<sym>, StateEstimationInput<sym>>(
-                [&state](Idx n_math_solvers) { return prepare_state_estimation_input<sym>(state, n_math_solvers); },
+                [this, &state](Idx n_math_solvers) -> auto const& {
+                    return prepare_state_estimation_input<sym>(state, n_math_solvers,
+                                                               calc_input_buffers_.template state_estimation<sym>());
+                },
                 [this, err_tol, max_iter, calculation_method](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
                                                               StateEstimationInput<sym> const& input) {
                     return solver.get().run_state_estimation(input, err_tol, max_iter, calculation_info_,
@@ -496,12 +521,17 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         < 0 sequential
         = 0 parallel, use number of hardware threads
         > 0 specify number of parallel threads
+    thread affinity (only applicable to parallel threads)
+        none    leave the placement of the threads to the operating system
+        pinned  pin each thread to its own core; the model copy and solvers of a thread are then allocated
+                (first-touch) on the NUMA node of that core
     raise a BatchCalculationError if any of the calculations in the batch raised an exception
     */
     template <typename Calculate>
         requires std::invocable<std::remove_cvref_t<Calculate>, MainModelImpl&, MutableDataset const&, Idx>
     BatchParameter batch_calculation_(Calculate&& calculation_fn, MutableDataset const& result_data,
-                                      ConstDataset const& update_data, Idx threading = sequential) {
+                                      ConstDataset const& update_data, Idx threading = sequential,
+                                      ThreadAffinity thread_affinity = ThreadAffinity::none) {
         // if the update dataset is empty without any component
         // execute one power flow in the current instance, no batch calculation is needed
         if (update_data.empty()) {
@@ -543,7 +573,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         auto sub_batch = sub_batch_calculation_(std::forward<Calculate>(calculation_fn), result_data, update_data,
                                                 all_scenarios_sequence, exceptions, infos);
 
-        batch_dispatch(sub_batch, n_scenarios, threading);
+        batch_dispatch(sub_batch, n_scenarios, threading, thread_affinity);
 
         handle_batch_exceptions(exceptions);
         calculation_info_ = main_core::merge_calculation_info(infos);
@@ -575,6 +605,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             assert(n_scenarios <= narrow_cast<Idx>(infos.size()));
 
             Timer const t_total(infos[start], 0000, "Total in thread");
+            report_thread_placement(infos[start]);
 
             auto const copy_model_functor = [&base_model, &infos](Idx scenario_idx) {
                 Timer const t_copy_model_functor(infos[scenario_idx], 1100, "Copy model");
@@ -603,31 +634,40 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         };
     }
 
-    // run sequential if
-    //    specified threading < 0
-    //    use hardware threads, but it is either unknown (0) or only has one thread (1)
-    //    specified threading = 1
+    // placement of the current batch worker thread, as set by batch_dispatch
+    // the calling thread is never pinned, so its placement is never reported
+    static ThreadPlacement& worker_thread_placement() {
+        thread_local ThreadPlacement placement{};
+        return placement;
+    }
+
+    static void report_thread_placement(CalculationInfo& info) {
+        ThreadPlacement const& placement = worker_thread_placement();
+        if (!placement.pinned) {
+            return;
+        }
+        info[Timer::make_key(1001, "Worker threads pinned to a core")] += 1.0;
+        if (placement.numa_node >= 0) {
+            info[Timer::make_key(1002, "Worker threads on NUMA node " + std::to_string(placement.numa_node))] +=
+                1.0;
+        }
+    }
+
+    // run the sub batches sequentially or in parallel threads, see common/threading.hpp for the threading convention
     template <typename RunSubBatchFn>
         requires std::invocable<std::remove_cvref_t<RunSubBatchFn>, Idx /*start*/, Idx /*stride*/, Idx /*n_scenarios*/>
-    static void batch_dispatch(RunSubBatchFn sub_batch, Idx n_scenarios, Idx threading) {
-        // run batches sequential or parallel
-        auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
-        if (threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2)) {
-            // run all in sequential
-            sub_batch(0, 1, n_scenarios);
-        } else {
-            // create parallel threads
-            Idx const n_thread = std::min(threading == 0 ? hardware_thread : threading, n_scenarios);
-            std::vector<std::thread> threads;
-            threads.reserve(n_thread);
-            for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
-                // compute each sub batch with stride
-                threads.emplace_back(sub_batch, thread_number, n_thread, n_scenarios);
+    static void batch_dispatch(RunSubBatchFn sub_batch, Idx n_scenarios, Idx threading,
+                               ThreadAffinity thread_affinity = ThreadAffinity::none) {
+        Idx const n_thread = get_n_threads(threading, n_scenarios);
+        // compute each sub batch with stride
+        run_in_threads(n_thread, [&sub_batch, n_thread, n_scenarios, thread_affinity](Idx thread_number) {
+            // pin before the sub batch copies the model, so that the copy is allocated on the local NUMA node
+            // the calling thread is never pinned
+            if (n_thread > 1 && thread_affinity == ThreadAffinity::pinned) {
+                worker_thread_placement() = pin_current_thread(thread_number);
             }
-            for (auto& thread : threads) {
-                thread.join();
-            }
-        }
+            sub_batch(thread_number, n_thread, n_scenarios);
+        });
     }
 
     template <typename... Args, typename RunFn, typename SetupFn, typename WinddownFn, typename HandleExceptionFn,
@@ -778,7 +818,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
                 auto const math_output = main_model_.calculate<calculation_type, sym>(options_);
 
                 if (pos_ != ignore_output) {
-                    main_model_.output_result(math_output, result_data_, pos_);
+                    main_model_.output_result(math_output, result_data_, pos_, options_.threading);
                 }
             },
             *this, options, result_data, pos);
@@ -788,15 +828,19 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     // Batch calculation, propagating the results to result_data
     BatchParameter calculate(Options const& options, MutableDataset const& result_data,
                              ConstDataset const& update_data) {
+        check_supported_components(update_data);
         return batch_calculation_(
-            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+            [&options, is_batch = !update_data.empty()](MainModelImpl& model, MutableDataset const& target_data,
+                                                        Idx pos) {
                 auto sub_opt = options; // copy
                 sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
                 sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+                // in a batch calculation the threads are already used for the scenarios
+                sub_opt.threading = is_batch ? sequential : options.threading;
 
                 model.calculate(sub_opt, target_data, pos);
             },
-            result_data, update_data, options.threading);
+            result_data, update_data, options.threading, options.thread_affinity);
     }
 
     CalculationInfo calculation_info() const { return calculation_info_; }
@@ -814,37 +858,78 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
   private:
     template <typename Component, typename MathOutputType, typename ResIt>
         requires solver_output_type<typename MathOutputType::SolverOutputType::value_type>
-    ResIt output_result(MathOutputType const& math_output, ResIt res_it) const {
+    ResIt output_result(MathOutputType const& math_output, ResIt res_it,
+                        main_core::detail::OutputRange range = {}) const {
         assert(construction_complete_);
-        return main_core::output_result<Component, ComponentContainer>(state_, math_output, res_it);
+        return main_core::output_result<Component, ComponentContainer>(state_, math_output, res_it, range);
     }
 
+    // produce the output of all component types
+    // the output of the component types, and of large component types in chunks of output_chunk_size components,
+    // is produced in parallel according to the threading option (see batch_calculation_),
+    // if there are enough components to make it worthwhile
+    // each chunk is written to its own part of the result buffers, so the result does not depend on the threading
     template <solver_output_type SolverOutputType>
     void output_result(MathOutput<std::vector<SolverOutputType>> const& math_output, MutableDataset const& result_data,
-                       Idx pos = 0) const {
-        auto const output_func = [this, &math_output, &result_data, pos]<typename CT>() {
-            auto process_output_span = [this, &math_output](auto const& span) {
-                if (std::empty(span)) {
-                    return;
+                       Idx pos = 0, Idx threading = sequential) const {
+        using OutputTask = std::function<void()>;
+        std::vector<OutputTask> output_tasks;
+        Idx n_total_component{0};
+
+        auto const output_func = [this, &math_output, &result_data, pos, &output_tasks,
+                                  &n_total_component]<typename CT>() {
+            auto add_output_span_tasks = [this, &math_output, &output_tasks, &n_total_component](auto const& span) {
+                Idx const n_component = narrow_cast<Idx>(std::size(span));
+                n_total_component += n_component;
+                for (Idx begin = 0; begin < n_component; begin += output_chunk_size) {
+                    main_core::detail::OutputRange const range{.begin = begin,
+                                                               .end = std::min(begin + output_chunk_size, n_component)};
+                    output_tasks.emplace_back([this, &math_output, span, range] {
+                        this->output_result<CT>(math_output, std::begin(span) + range.begin, range);
+                    });
                 }
-                this->output_result<CT>(math_output, std::begin(span));
             };
 
             if (result_data.is_columnar(CT::name)) {
                 auto const span =
                     result_data.get_columnar_buffer_span<typename output_type_getter<SolverOutputType>::type, CT>(pos);
-                process_output_span(span);
+                add_output_span_tasks(span);
             } else {
                 auto const span =
                     result_data.get_buffer_span<typename output_type_getter<SolverOutputType>::type, CT>(pos);
-                process_output_span(span);
+                add_output_span_tasks(span);
             }
         };
 
         Timer const t_output(calculation_info_, 3000, "Produce output");
         main_core::utils::run_functor_with_all_types_return_void<ComponentType...>(output_func);
+
+        Idx const n_task = std::ssize(output_tasks);
+        if (n_total_component < output_chunk_size) {
+            threading = sequential;
+        }
+        std::vector<std::exception_ptr> exceptions(n_task);
+        batch_dispatch(
+            [&output_tasks, &exceptions](Idx start, Idx stride, Idx n_task_) {
+                for (Idx task = start; task < n_task_; task += stride) {
+                    try {
+                        output_tasks[task]();
+                    } catch (...) {
+                        exceptions[task] = std::current_exception();
+                    }
+                }
+            },
+            n_task, threading);
+        // rethrow the first exception, in the order of the sequential output
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
     }
 
+    static constexpr Idx output_chunk_size = Idx{1} << 14;
+
     mutable CalculationInfo calculation_info_; // needs to be first due to padding override
                                                // may be changed in const functions for metrics
 
@@ -855,6 +940,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     MainModelState state_;
     // math model
     MathState math_state_;
+    main_core::CalculationInputBuffers calc_input_buffers_;
     Idx n_math_solvers_{0};
     bool is_topology_up_to_date_{false};
     bool is_sym_parameter_up_to_date_{false};
@@ -934,6 +1020,23 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         is_asym_parameter_up_to_date_ = false;
     }
 
+    // run the functor on all components of the base type, one storage type at a time
+    // the components of each type are visited in their contiguous storage, with their concrete (final) type,
+    // so that the per-component calculations are resolved statically in a tight loop
+    // the functor receives the sequence index of the component in the base type and the component itself
+    template <typename BaseComponent, typename Functor> void for_each_component_per_type(Functor functor) const {
+        main_core::utils::run_functor_with_all_types_return_void<ComponentType...>(
+            [this, &functor]<typename CompType>() {
+                if constexpr (std::derived_from<CompType, BaseComponent>) {
+                    Idx seq = state_.components.template get_start_idx<BaseComponent, CompType>();
+                    for (CompType const& component : state_.components.template citer_storage<CompType>()) {
+                        functor(seq, component);
+                        ++seq;
+                    }
+                }
+            });
+    }
+
     template <symmetry_tag sym> std::vector<MathModelParam<sym>> get_math_param() {
         std::vector<MathModelParam<sym>> math_param(n_math_solvers_);
         for (Idx i = 0; i != n_math_solvers_; ++i) {
@@ -942,56 +1045,59 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             math_param[i].source_param.resize(state_.math_topology[i]->n_source());
         }
         // loop all branch
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->branch_node_idx.size()); ++i) {
-            Idx2D const math_idx = state_.topo_comp_coup->branch[i];
+        for_each_component_per_type<Branch>([this, &math_param](Idx seq, auto const& branch) {
+            using BranchType = std::remove_cvref_t<decltype(branch)>;
+            Idx2D const math_idx = state_.topo_comp_coup->branch[seq];
             if (math_idx.group == isolated_component) {
-                continue;
+                return;
             }
             // assign parameters
-            math_param[math_idx.group].branch_param[math_idx.pos] =
-                state_.components.template get_item_by_seq<Branch>(i).template calc_param<sym>();
-        }
+            math_param[math_idx.group].branch_param[math_idx.pos] = branch.template calc_param<sym, BranchType>();
+        });
         // loop all branch3
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->branch3_node_idx.size()); ++i) {
-            Idx2DBranch3 const math_idx = state_.topo_comp_coup->branch3[i];
+        for_each_component_per_type<Branch3>([this, &math_param](Idx seq, auto const& branch3) {
+            using Branch3Type = std::remove_cvref_t<decltype(branch3)>;
+            Idx2DBranch3 const math_idx = state_.topo_comp_coup->branch3[seq];
             if (math_idx.group == isolated_component) {
-                continue;
+                return;
             }
             // assign parameters, branch3 param consists of three branch parameters
-            auto const branch3_param =
-                state_.components.template get_item_by_seq<Branch3>(i).template calc_param<sym>();
+            auto const branch3_param = branch3.template calc_param<sym, Branch3Type>();
             for (size_t branch2 = 0; branch2 < 3; ++branch2) {
                 math_param[math_idx.group].branch_param[math_idx.pos[branch2]] = branch3_param[branch2];
             }
-        }
+        });
         // loop all shunt
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->shunt_node_idx.size()); ++i) {
-            Idx2D const math_idx = state_.topo_comp_coup->shunt[i];
+        for_each_component_per_type<Shunt>([this, &math_param](Idx seq, Shunt const& shunt) {
+            Idx2D const math_idx = state_.topo_comp_coup->shunt[seq];
             if (math_idx.group == isolated_component) {
-                continue;
+                return;
             }
             // assign parameters
-            math_param[math_idx.group].shunt_param[math_idx.pos] =
-                state_.components.template get_item_by_seq<Shunt>(i).template calc_param<sym>();
-        }
+            math_param[math_idx.group].shunt_param[math_idx.pos] = shunt.template calc_param<sym>();
+        });
         // loop all source
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->source_node_idx.size()); ++i) {
-            Idx2D const math_idx = state_.topo_comp_coup->source[i];
+        for_each_component_per_type<Source>([this, &math_param](Idx seq, Source const& source) {
+            Idx2D const math_idx = state_.topo_comp_coup->source[seq];
             if (math_idx.group == isolated_component) {
-                continue;
+                return;
             }
             // assign parameters
-            math_param[math_idx.group].source_param[math_idx.pos] =
-                state_.components.template get_item_by_seq<Source>(i).template math_param<sym>();
-        }
+            math_param[math_idx.group].source_param[math_idx.pos] = source.template math_param<sym>();
+        });
         return math_param;
     }
-    template <symmetry_tag sym> std::vector<MathModelParamIncrement> get_math_param_increment() {
-        using AddToIncrement = void (*)(std::vector<MathModelParamIncrement>&, MainModelState const&, Idx2D const&);
+
+    // collect the indices and the recalculated parameters of the branches, branch3s and shunts changed since the last
+    // parameter preparation, per math model. Source parameters only change together with the topology.
+    template <symmetry_tag sym>
+    std::pair<std::vector<MathModelParamIncrement>, std::vector<MathModelParamUpdate<sym>>> get_math_param_increment() {
+        using AddToIncrement = void (*)(std::vector<MathModelParamIncrement>&, std::vector<MathModelParamUpdate<sym>>&,
+                                        MainModelState const&, Idx2D const&);
 
         static constexpr std::array<AddToIncrement, main_core::utils::n_types<ComponentType...>> add_to_increments{
-            [](std::vector<MathModelParamIncrement>& increments, MainModelState const& state,
-               Idx2D const& changed_component_idx) {
+            [](std::vector<MathModelParamIncrement>& increments, std::vector<MathModelParamUpdate<sym>>& updates,
+               MainModelState const& state, Idx2D const& changed_component_idx) {
                 if constexpr (std::derived_from<ComponentType, Branch>) {
                     Idx2D const math_idx =
                         state.topo_comp_coup
@@ -1001,6 +1107,9 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
                     }
                     // assign parameters
                     increments[math_idx.group].branch_param_to_change.push_back(math_idx.pos);
+                    updates[math_idx.group].branch_param.push_back(
+                        main_core::get_component<ComponentType>(state, changed_component_idx)
+                            .template calc_param<sym, ComponentType>());
                 } else if constexpr (std::derived_from<ComponentType, Branch3>) {
                     Idx2DBranch3 const math_idx =
                         state.topo_comp_coup
@@ -1009,10 +1118,12 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
                         return;
                     }
                     // assign parameters, branch3 param consists of three branch parameters
-                    // auto const branch3_param =
-                    //   get_component<Branch3>(state, changed_component_idx).template calc_param<sym>();
+                    auto const branch3_param =
+                        main_core::get_component<ComponentType>(state, changed_component_idx)
+                            .template calc_param<sym, ComponentType>();
                     for (size_t branch2 = 0; branch2 < 3; ++branch2) {
                         increments[math_idx.group].branch_param_to_change.push_back(math_idx.pos[branch2]);
+                        updates[math_idx.group].branch_param.push_back(branch3_param[branch2]);
                     }
                 } else if constexpr (std::same_as<ComponentType, Shunt>) {
                     Idx2D const math_idx =
@@ -1023,20 +1134,24 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
                     }
                     // assign parameters
                     increments[math_idx.group].shunt_param_to_change.push_back(math_idx.pos);
+                    updates[math_idx.group].shunt_param.push_back(
+                        main_core::get_component<ComponentType>(state, changed_component_idx)
+                            .template calc_param<sym>());
                 }
             }...};
 
         std::vector<MathModelParamIncrement> math_param_increment(n_math_solvers_);
+        std::vector<MathModelParamUpdate<sym>> math_param_update(n_math_solvers_);
 
         for (size_t i = 0; i < main_core::utils::n_types<ComponentType...>; ++i) {
             auto const& changed_type_components = parameter_changed_components_[i];
             auto const& add_type_to_increment = add_to_increments[i];
             for (auto const& changed_component : changed_type_components) {
-                add_type_to_increment(math_param_increment, state_, changed_component);
+                add_type_to_increment(math_param_increment, math_param_update, state_, changed_component);
             }
         }
 
-        return math_param_increment;
+        return {std::move(math_param_increment), std::move(math_param_update)};
     }
 
     /** This is a heavily templated member function because it operates on many different variables of many
@@ -1078,8 +1193,8 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
      *automatically deduced.
      *
      * @param component[in]
-     *      The vector of component math indices to consider (e.g. state_.topo_comp_coup->source).
-     *      When idx.group = -1, the original component is not assigned to a math model, so we can skip it.
+     *      The flat coupling of the components to consider (e.g. state_.topo_comp_coup->flat_source).
+     *      Only the components assigned to a math model are in it, grouped per math model.
      *
      * @param calc_input[out]
      *		Although this variable is called `input`, it is actually the output of this function, it stored
@@ -1093,16 +1208,16 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
               std::vector<CalcParamOut>(CalcStructOut::*comp_vect), class ComponentIn,
               std::invocable<Idx> PredicateIn = IncludeAll>
         requires std::convertible_to<std::invoke_result_t<PredicateIn, Idx>, bool>
-    static void prepare_input(MainModelState const& state, std::vector<Idx2D> const& components,
+    static void prepare_input(MainModelState const& state, FlatComponentToMathCoupling const& components,
                               std::vector<CalcStructOut>& calc_input, PredicateIn include = include_all) {
-        for (Idx i = 0, n = narrow_cast<Idx>(components.size()); i != n; ++i) {
-            if (include(i)) {
-                Idx2D const math_idx = components[i];
-                if (math_idx.group != isolated_component) {
+        for (Idx math_model = 0; math_model != components.n_math_model(); ++math_model) {
+            std::vector<CalcParamOut>& math_model_input_vect = calc_input[math_model].*comp_vect;
+            for (Idx k = components.math_model_indptr[math_model]; k != components.math_model_indptr[math_model + 1];
+                 ++k) {
+                Idx const i = components.component_seq[k];
+                if (include(i)) {
                     auto const& component = get_component_by_sequence<ComponentIn>(state, i);
-                    CalcStructOut& math_model_input = calc_input[math_idx.group];
-                    std::vector<CalcParamOut>& math_model_input_vect = math_model_input.*comp_vect;
-                    math_model_input_vect[math_idx.pos] = detail::calculate_param<CalcStructOut>(component);
+                    math_model_input_vect[components.math_pos[k]] = detail::calculate_param<CalcStructOut>(component);
                 }
             }
         }
@@ -1112,17 +1227,17 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
               std::vector<CalcParamOut>(CalcStructOut::*comp_vect), class ComponentIn,
               std::invocable<Idx> PredicateIn = IncludeAll>
         requires std::convertible_to<std::invoke_result_t<PredicateIn, Idx>, bool>
-    static void prepare_input(MainModelState const& state, std::vector<Idx2D> const& components,
+    static void prepare_input(MainModelState const& state, FlatComponentToMathCoupling const& components,
                               std::vector<CalcStructOut>& calc_input,
                               std::invocable<ComponentIn const&> auto extra_args, PredicateIn include = include_all) {
-        for (Idx i = 0, n = narrow_cast<Idx>(components.size()); i != n; ++i) {
-            if (include(i)) {
-                Idx2D const math_idx = components[i];
-                if (math_idx.group != isolated_component) {
+        for (Idx math_model = 0; math_model != components.n_math_model(); ++math_model) {
+            std::vector<CalcParamOut>& math_model_input_vect = calc_input[math_model].*comp_vect;
+            for (Idx k = components.math_model_indptr[math_model]; k != components.math_model_indptr[math_model + 1];
+                 ++k) {
+                Idx const i = components.component_seq[k];
+                if (include(i)) {
                     auto const& component = get_component_by_sequence<ComponentIn>(state, i);
-                    CalcStructOut& math_model_input = calc_input[math_idx.group];
-                    std::vector<CalcParamOut>& math_model_input_vect = math_model_input.*comp_vect;
-                    math_model_input_vect[math_idx.pos] =
+                    math_model_input_vect[components.math_pos[k]] =
                         detail::calculate_param<CalcStructOut>(component, extra_args(component));
                 }
             }
@@ -1130,38 +1245,42 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     }
 
     template <symmetry_tag sym, IntSVector(StateEstimationInput<sym>::*component), class Component>
-    static void prepare_input_status(MainModelState const& state, std::vector<Idx2D> const& objects,
+    static void prepare_input_status(MainModelState const& state, FlatComponentToMathCoupling const& objects,
                                      std::vector<StateEstimationInput<sym>>& input) {
-        for (Idx i = 0, n = narrow_cast<Idx>(objects.size()); i != n; ++i) {
-            Idx2D const math_idx = objects[i];
-            if (math_idx.group == isolated_component) {
-                continue;
+        for (Idx math_model = 0; math_model != objects.n_math_model(); ++math_model) {
+            IntSVector& math_model_status = input[math_model].*component;
+            for (Idx k = objects.math_model_indptr[math_model]; k != objects.math_model_indptr[math_model + 1]; ++k) {
+                math_model_status[objects.math_pos[k]] =
+                    main_core::get_component_by_sequence<Component>(state, objects.component_seq[k]).status();
             }
-            (input[math_idx.group].*component)[math_idx.pos] =
-                main_core::get_component_by_sequence<Component>(state, i).status();
         }
     }
 
+    // the input is prepared in the provided buffer, reusing its allocated memory where possible
     template <symmetry_tag sym>
-    static std::vector<PowerFlowInput<sym>> prepare_power_flow_input(MainModelState const& state, Idx n_math_solvers) {
-        std::vector<PowerFlowInput<sym>> pf_input(n_math_solvers);
+    static std::vector<PowerFlowInput<sym>> const& prepare_power_flow_input(MainModelState const& state,
+                                                                           Idx n_math_solvers,
+                                                                           std::vector<PowerFlowInput<sym>>& pf_input) {
+        pf_input.resize(n_math_solvers);
         for (Idx i = 0; i != n_math_solvers; ++i) {
             pf_input[i].s_injection.resize(state.math_topology[i]->n_load_gen());
             pf_input[i].source.resize(state.math_topology[i]->n_source());
         }
         prepare_input<PowerFlowInput<sym>, DoubleComplex, &PowerFlowInput<sym>::source, Source>(
-            state, state.topo_comp_coup->source, pf_input);
+            state, state.topo_comp_coup->flat_source, pf_input);
 
         prepare_input<PowerFlowInput<sym>, ComplexValue<sym>, &PowerFlowInput<sym>::s_injection, GenericLoadGen>(
-            state, state.topo_comp_coup->load_gen, pf_input);
+            state, state.topo_comp_coup->flat_load_gen, pf_input);
 
         return pf_input;
     }
 
+    // the input is prepared in the provided buffer, reusing its allocated memory where possible
     template <symmetry_tag sym>
-    static std::vector<StateEstimationInput<sym>> prepare_state_estimation_input(MainModelState const& state,
-                                                                                 Idx n_math_solvers) {
-        std::vector<StateEstimationInput<sym>> se_input(n_math_solvers);
+    static std::vector<StateEstimationInput<sym>> const&
+    prepare_state_estimation_input(MainModelState const& state, Idx n_math_solvers,
+                                   std::vector<StateEstimationInput<sym>>& se_input) {
+        se_input.resize(n_math_solvers);
 
         for (Idx i = 0; i != n_math_solvers; ++i) {
             se_input[i].shunt_status.resize(state.math_topology[i]->n_shunt());
@@ -1178,33 +1297,33 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             se_input[i].measured_branch_to_current.resize(state.math_topology[i]->n_branch_to_current_sensor());
         }
 
-        prepare_input_status<sym, &StateEstimationInput<sym>::shunt_status, Shunt>(state, state.topo_comp_coup->shunt,
-                                                                                   se_input);
+        prepare_input_status<sym, &StateEstimationInput<sym>::shunt_status, Shunt>(
+            state, state.topo_comp_coup->flat_shunt, se_input);
         prepare_input_status<sym, &StateEstimationInput<sym>::load_gen_status, GenericLoadGen>(
-            state, state.topo_comp_coup->load_gen, se_input);
+            state, state.topo_comp_coup->flat_load_gen, se_input);
         prepare_input_status<sym, &StateEstimationInput<sym>::source_status, Source>(
-            state, state.topo_comp_coup->source, se_input);
+            state, state.topo_comp_coup->flat_source, se_input);
 
         prepare_input<StateEstimationInput<sym>, VoltageSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_voltage, GenericVoltageSensor>(
-            state, state.topo_comp_coup->voltage_sensor, se_input);
+            state, state.topo_comp_coup->flat_voltage_sensor, se_input);
         prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_source_power, GenericPowerSensor>(
-            state, state.topo_comp_coup->power_sensor, se_input,
+            state, state.topo_comp_coup->flat_power_sensor, se_input,
             [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::source; });
         prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_load_gen_power, GenericPowerSensor>(
-            state, state.topo_comp_coup->power_sensor, se_input, [&state](Idx i) {
+            state, state.topo_comp_coup->flat_power_sensor, se_input, [&state](Idx i) {
                 return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::load ||
                        state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::generator;
             });
         prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_shunt_power, GenericPowerSensor>(
-            state, state.topo_comp_coup->power_sensor, se_input,
+            state, state.topo_comp_coup->flat_power_sensor, se_input,
             [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::shunt; });
         prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_branch_from_power, GenericPowerSensor>(
-            state, state.topo_comp_coup->power_sensor, se_input, [&state](Idx i) {
+            state, state.topo_comp_coup->flat_power_sensor, se_input, [&state](Idx i) {
                 using enum MeasuredTerminalType;
                 return state.comp_topo->power_sensor_terminal_type[i] == branch_from ||
                        // all branch3 sensors are at from side in the mathematical model
@@ -1214,17 +1333,17 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             });
         prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_branch_to_power, GenericPowerSensor>(
-            state, state.topo_comp_coup->power_sensor, se_input, [&state](Idx i) {
+            state, state.topo_comp_coup->flat_power_sensor, se_input, [&state](Idx i) {
                 return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::branch_to;
             });
         prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_bus_injection, GenericPowerSensor>(
-            state, state.topo_comp_coup->power_sensor, se_input,
+            state, state.topo_comp_coup->flat_power_sensor, se_input,
             [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::node; });
 
         prepare_input<StateEstimationInput<sym>, CurrentSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_branch_from_current, GenericCurrentSensor>(
-            state, state.topo_comp_coup->current_sensor, se_input, [&state](Idx i) {
+            state, state.topo_comp_coup->flat_current_sensor, se_input, [&state](Idx i) {
                 using enum MeasuredTerminalType;
                 return state.comp_topo->current_sensor_terminal_type[i] == branch_from ||
                        // all branch3 sensors are at from side in the mathematical model
@@ -1234,7 +1353,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             });
         prepare_input<StateEstimationInput<sym>, CurrentSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_branch_to_current, GenericCurrentSensor>(
-            state, state.topo_comp_coup->current_sensor, se_input, [&state](Idx i) {
+            state, state.topo_comp_coup->flat_current_sensor, se_input, [&state](Idx i) {
                 return state.comp_topo->current_sensor_terminal_type[i] == MeasuredTerminalType::branch_to;
             });
 
@@ -1279,11 +1398,11 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         state_.comp_coup = ComponentToMathCoupling{.fault = std::move(fault_coup)};
 
         prepare_input<ShortCircuitInput, FaultCalcParam, &ShortCircuitInput::faults, Fault>(
-            state_, state_.comp_coup.fault, sc_input, [this](Fault const& fault) {
+            state_, flatten_coupling(state_.comp_coup.fault, n_math_solvers_), sc_input, [this](Fault const& fault) {
                 return state_.components.template get_item<Node>(fault.get_fault_object()).u_rated();
             });
         prepare_input<ShortCircuitInput, DoubleComplex, &ShortCircuitInput::source, Source>(
-            state_, state_.topo_comp_coup->source, sc_input, [this, voltage_scaling](Source const& source) {
+            state_, state_.topo_comp_coup->flat_source, sc_input, [this, voltage_scaling](Source const& source) {
                 return std::pair{state_.components.template get_item<Node>(source.node()).u_rated(), voltage_scaling};
             });
 
@@ -1311,12 +1430,10 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             for (Idx i = 0; i != n_math_solvers_; ++i) {
                 // construct from existing Y_bus structure if possible
                 if (other_y_bus_exist) {
-                    y_bus_vec.emplace_back(state_.math_topology[i],
-                                           std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])),
+                    y_bus_vec.emplace_back(state_.math_topology[i], math_params[i],
                                            other_y_bus_vec[i].get_y_bus_structure());
                 } else {
-                    y_bus_vec.emplace_back(state_.math_topology[i],
-                                           std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])));
+                    y_bus_vec.emplace_back(state_.math_topology[i], math_params[i]);
                 }
 
                 y_bus_vec.back().set_branch_param_idx(
@@ -1352,12 +1469,12 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
                     });
             }
         } else if (!is_parameter_up_to_date<sym>()) {
-            std::vector<MathModelParam<sym>> const math_params = get_math_param<sym>();
-            std::vector<MathModelParamIncrement> const math_param_increments = get_math_param_increment<sym>();
             if (last_updated_calculation_symmetry_mode_ == is_symmetric_v<sym>) {
-                main_core::update_y_bus(math_state_, math_params, math_param_increments);
+                // only recalculate the parameters of the changed components
+                auto const [math_param_increments, math_param_updates] = get_math_param_increment<sym>();
+                main_core::update_y_bus(math_state_, math_param_increments, math_param_updates);
             } else {
-                main_core::update_y_bus(math_state_, math_params);
+                main_core::update_y_bus(math_state_, get_math_param<sym>());
             }
         }
         // else do nothing, set everything up to date
@@ -61,6 +61,14 @@ template <symmetry_tag sym> class ILSEGainBlock : public Block<DoubleComplex, sy
     GetterType<1, 1> r() { return this->template get_val<1, 1>(); }
 };
 
+// settings of the bad data detection after the state estimation has converged
+// the measurement with the largest normalized residual above the threshold is down-weighted and the state is
+// estimated again, for at most max_bad_data times; the detection is disabled if max_bad_data is zero
+struct BadDataDetection {
+    Idx max_bad_data{0};
+    double threshold{3.0};
+};
+
 template <symmetry_tag sym_type> class IterativeLinearSESolver {
   public:
     using sym = sym_type;
@@ -74,9 +82,11 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
     static constexpr Idx bsr_block_size_ = is_symmetric_v<sym> ? 2 : 6;
 
   public:
-    IterativeLinearSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr)
+    IterativeLinearSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr,
+                            BadDataDetection bad_data_detection = {})
         : n_bus_{y_bus.size()},
           math_topo_{std::move(topo_ptr)},
+          bad_data_detection_{bad_data_detection},
           data_gain_(y_bus.nnz_lu()),
           x_rhs_(y_bus.size()),
           sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
@@ -90,15 +100,14 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         SolverOutput<sym> output;
         output.u.resize(n_bus_);
         output.bus_injection.resize(n_bus_);
-        double max_dev = std::numeric_limits<double>::max();
 
         main_timer = Timer(calculation_info, 2220, "Math solver");
 
         // preprocess measured value
         sub_timer = Timer(calculation_info, 2221, "Pre-process measured value");
-        MeasuredValues<sym> const measured_values{y_bus.shared_topology(), input};
+        MeasuredValues<sym> measured_values{y_bus.shared_topology(), input};
         auto const observability_result =
-            necessary_observability_check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+            observability_cache_.check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
 
         // prepare matrix
         sub_timer = Timer(calculation_info, 2222, "Prepare matrix, including pre-factorization");
@@ -113,20 +122,41 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
             output.u[bus] = exp(1.0i * (mean_angle_shift + math_topo_->phase_shift[bus]));
         }
 
-        // loop to iterate
-        Idx num_iter = 0;
-        while (max_dev > err_tol || num_iter == 0) {
-            if (num_iter++ == max_iter) {
-                throw IterationDiverge{max_iter, max_dev, err_tol};
+        // loop to iterate, starting from the current voltages
+        auto const iterate = [&]() {
+            Idx num_iter = 0;
+            double max_dev = std::numeric_limits<double>::max();
+            while (max_dev > err_tol || num_iter == 0) {
+                if (num_iter++ == max_iter) {
+                    throw IterationDiverge{max_iter, max_dev, err_tol};
+                }
+                sub_timer = Timer(calculation_info, 2224, "Calculate rhs");
+                prepare_rhs(y_bus, measured_values, output.u);
+                // solve with prefactorization
+                sub_timer = Timer(calculation_info, 2225, "Solve sparse linear equation (pre-factorized)");
+                sparse_solver_.solve_with_prefactorized_matrix(data_gain_, perm_, x_rhs_, x_rhs_);
+                sub_timer = Timer(calculation_info, 2226, "Iterate unknown");
+                max_dev = iterate_unknown(output.u, measured_values.has_angle());
             }
-            sub_timer = Timer(calculation_info, 2224, "Calculate rhs");
-            prepare_rhs(y_bus, measured_values, output.u);
-            // solve with prefactorization
-            sub_timer = Timer(calculation_info, 2225, "Solve sparse linear equation (pre-factorized)");
-            sparse_solver_.solve_with_prefactorized_matrix(data_gain_, perm_, x_rhs_, x_rhs_);
-            sub_timer = Timer(calculation_info, 2226, "Iterate unknown");
-            max_dev = iterate_unknown(output.u, measured_values.has_angle());
+            return num_iter;
         };
+        Idx num_iter = iterate();
+
+        // detect bad data one measurement at a time
+        // reweight the worst measurement and solve again, warm started with the current voltages
+        Idx n_bad_data = 0;
+        while (n_bad_data != bad_data_detection_.max_bad_data) {
+            sub_timer = Timer(calculation_info, 2229, "Detect bad data");
+            if (!reweight_bad_data(y_bus, measured_values, output.u)) {
+                break;
+            }
+            ++n_bad_data;
+            // the sparsity pattern does not change, only the numerical values are factorized again
+            sub_timer = Timer(calculation_info, 2222, "Prepare matrix, including pre-factorization");
+            prepare_matrix(y_bus, measured_values);
+            sparse_solver_.prefactorize(data_gain_, perm_, observability_result.use_perturbation());
+            num_iter = std::max(num_iter, iterate());
+        }
 
         // calculate math result
         sub_timer = Timer(calculation_info, 2227, "Calculate math result");
@@ -138,6 +168,10 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
 
         auto const key = Timer::make_key(2228, "Max number of iterations");
         calculation_info[key] = std::max(calculation_info[key], static_cast<double>(num_iter));
+        if (bad_data_detection_.max_bad_data > 0) {
+            calculation_info[Timer::make_key(2230, "Number of reweighted bad data measurements")] +=
+                static_cast<double>(n_bad_data);
+        }
 
         return output;
     }
@@ -153,9 +187,40 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
     static constexpr std::array branch_current_{&MeasuredValues<sym>::branch_from_current,
                                                 &MeasuredValues<sym>::branch_to_current};
 
+    // measurement types considered in the bad data detection
+    enum class MeasurementType : IntS {
+        voltage = 0,
+        bus_injection = 1,
+        shunt_power = 2,
+        branch_from_power = 3,
+        branch_to_power = 4,
+        branch_from_current = 5,
+        branch_to_current = 6,
+    };
+    static constexpr std::array branch_power_type_{MeasurementType::branch_from_power,
+                                                   MeasurementType::branch_to_power};
+    static constexpr std::array branch_current_type_{MeasurementType::branch_from_current,
+                                                     MeasurementType::branch_to_current};
+
+    // residual of a measurement, in the current domain of the linearized measurement equations
+    struct MeasurementResidual {
+        MeasurementType type{};
+        Idx obj{};
+        Idx measured_bus{}; // bus of which the voltage is used to linearize the measurement
+        ComplexValue<sym> residual{};
+        RealValue<sym> variance{}; // normalized
+        double weighted_residual{};
+    };
+
+    // number of measurements with the largest weighted residuals, for which the normalized residual is calculated
+    static constexpr Idx n_bad_data_candidates = 5;
+    // a measurement is critical if its residual variance is negligible compared to its own variance
+    static constexpr double critical_residual_variance_ratio = 1e-6;
+
     Idx n_bus_;
     // shared topo data
     std::shared_ptr<MathModelTopology const> math_topo_;
+    BadDataDetection bad_data_detection_;
 
     // data for gain matrix
     std::vector<ILSEGainBlock<sym>> data_gain_;
@@ -164,6 +229,8 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
     // solver
     SparseLUSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>> sparse_solver_;
     typename SparseLUSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>>::BlockPermArray perm_;
+    // observability of the previous run
+    ObservabilityCache observability_cache_;
 
     static auto diagonal_inverse(RealValue<sym> const& value) {
         return ComplexDiagonalTensor<sym>{static_cast<ComplexValue<sym>>(RealValue<sym>{1.0} / value)};
@@ -351,6 +418,207 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         }
     }
 
+    // find the measurement with the largest normalized residual r_N = |r| / sqrt(Omega)
+    //     Omega = variance - h * G^-1 * h^H, the variance of the residual
+    //     h the row of the measurement jacobian, G the gain matrix with the injection constraints eliminated
+    // h * G^-1 * h^H is calculated per phase by solving the pre-factorized system with rhs [h^H, 0],
+    // this is only done for the candidates with the largest weighted residuals |r| / sqrt(variance) <= r_N
+    // if r_N exceeds the threshold, the variance of the measurement is scaled up by (r_N / threshold)^2
+    // returns whether a measurement was reweighted
+    bool reweight_bad_data(YBus<sym> const& y_bus, MeasuredValues<sym>& measured_values,
+                           ComplexValueVector<sym> const& u) {
+        auto residuals = calculate_residuals(y_bus, measured_values, u);
+        auto const n_candidates = std::min(n_bad_data_candidates, static_cast<Idx>(residuals.size()));
+        std::ranges::partial_sort(residuals, residuals.begin() + n_candidates, std::ranges::greater{},
+                                  &MeasurementResidual::weighted_residual);
+
+        MeasurementResidual const* worst{};
+        double max_normalized_residual = bad_data_detection_.threshold;
+        for (auto const& candidate : std::span{residuals.begin(), static_cast<size_t>(n_candidates)}) {
+            double const normalized_residual =
+                calculate_normalized_residual(y_bus, candidate, measured_values.variance_scale());
+            if (normalized_residual > max_normalized_residual) {
+                max_normalized_residual = normalized_residual;
+                worst = &candidate;
+            }
+        }
+        if (worst == nullptr) {
+            return false;
+        }
+
+        double const factor = (max_normalized_residual / bad_data_detection_.threshold) *
+                              (max_normalized_residual / bad_data_detection_.threshold);
+        switch (worst->type) {
+        case MeasurementType::voltage:
+            measured_values.scale_voltage_variance(worst->obj, factor);
+            break;
+        case MeasurementType::bus_injection:
+            measured_values.scale_bus_injection_variance(worst->obj, factor);
+            break;
+        case MeasurementType::shunt_power:
+            measured_values.scale_shunt_power_variance(worst->obj, factor);
+            break;
+        case MeasurementType::branch_from_power:
+            measured_values.scale_branch_from_power_variance(worst->obj, factor);
+            break;
+        case MeasurementType::branch_to_power:
+            measured_values.scale_branch_to_power_variance(worst->obj, factor);
+            break;
+        case MeasurementType::branch_from_current:
+            measured_values.scale_branch_from_current_variance(worst->obj, factor);
+            break;
+        case MeasurementType::branch_to_current:
+            measured_values.scale_branch_to_current_variance(worst->obj, factor);
+            break;
+        default:
+            throw MissingCaseForEnumError{"MeasurementType", worst->type};
+        }
+        return true;
+    }
+
+    std::vector<MeasurementResidual> calculate_residuals(YBus<sym> const& y_bus,
+                                                         MeasuredValues<sym> const& measured_value,
+                                                         ComplexValueVector<sym> const& current_u) const {
+        std::vector<BranchIdx> const& branch_bus_idx = y_bus.math_topology().branch_bus_idx;
+        ComplexValueVector<sym> const u = linearize_measurements(current_u, measured_value);
+        double const variance_scale = measured_value.variance_scale();
+
+        std::vector<MeasurementResidual> residuals;
+        auto const add_residual = [&](MeasurementType type, Idx obj, Idx measured_bus,
+                                      IndependentComplexRandVar<sym> const& measurement) {
+            MeasurementResidual residual{.type = type,
+                                         .obj = obj,
+                                         .measured_bus = measured_bus,
+                                         .residual = measurement.value,
+                                         .variance = measurement.variance};
+            for_each_jacobian_entry(y_bus, residual, [&residual, &current_u](Idx bus, ComplexTensor<sym> const& h) {
+                residual.residual -= dot(h, current_u[bus]);
+            });
+            residual.weighted_residual =
+                max_val(cabs(residual.residual) / sqrt(residual.variance * variance_scale));
+            residuals.push_back(residual);
+        };
+
+        for (auto const& [bus, shunts] : enumerated_zip_sequence(y_bus.math_topology().shunts_per_bus)) {
+            if (measured_value.has_voltage(bus)) {
+                add_residual(MeasurementType::voltage, bus, bus,
+                             {.value = u[bus], .variance = RealValue<sym>{measured_value.voltage_var(bus)}});
+            }
+            // zero variance means a constraint, which is never bad data
+            if (measured_value.has_bus_injection(bus)) {
+                auto const current = power_to_global_current_measurement(measured_value.bus_injection(bus), u[bus]);
+                if (max_val(current.variance) > 0.0) {
+                    add_residual(MeasurementType::bus_injection, bus, bus, current);
+                }
+            }
+            for (Idx const shunt : shunts) {
+                if (measured_value.has_shunt(shunt)) {
+                    add_residual(MeasurementType::shunt_power, shunt, bus,
+                                 power_to_global_current_measurement(measured_value.shunt_power(shunt), u[bus]));
+                }
+            }
+        }
+        for (Idx branch = 0; branch != static_cast<Idx>(branch_bus_idx.size()); ++branch) {
+            // measured at from-side: 0, to-side: 1
+            for (IntS const measured_side : std::array<IntS, 2>{0, 1}) {
+                Idx const measured_bus = branch_bus_idx[branch][measured_side];
+                if (std::invoke(has_branch_power_[measured_side], measured_value, branch)) {
+                    auto const& branch_power = std::invoke(branch_power_[measured_side], measured_value, branch);
+                    add_residual(branch_power_type_[measured_side], branch, measured_bus,
+                                 power_to_global_current_measurement(branch_power, u[measured_bus]));
+                }
+                if (std::invoke(has_branch_current_[measured_side], measured_value, branch)) {
+                    auto const& branch_current = std::invoke(branch_current_[measured_side], measured_value, branch);
+                    add_residual(branch_current_type_[measured_side], branch, measured_bus,
+                                 current_to_global_current_measurement(branch_current, u[measured_bus]));
+                }
+            }
+        }
+        return residuals;
+    }
+
+    // the largest normalized residual of all phases of the measurement
+    // critical measurements, of which the residual is always (close to) zero, are skipped
+    double calculate_normalized_residual(YBus<sym> const& y_bus, MeasurementResidual const& residual,
+                                         double variance_scale) {
+        double max_normalized_residual = 0.0;
+        for (Idx phase = 0; phase != (is_symmetric_v<sym> ? 1 : 3); ++phase) {
+            for (auto& x : x_rhs_) {
+                x.clear();
+            }
+            for_each_jacobian_entry(y_bus, residual, [this, phase](Idx bus, ComplexTensor<sym> const& h) {
+                x_rhs_[bus].eta() += conj(jacobian_row(h, phase));
+            });
+            sparse_solver_.solve_with_prefactorized_matrix(data_gain_, perm_, x_rhs_, x_rhs_);
+            double estimated_variance = 0.0;
+            for_each_jacobian_entry(y_bus, residual,
+                                    [this, phase, &estimated_variance](Idx bus, ComplexTensor<sym> const& h) {
+                                        estimated_variance += real(sum_val(jacobian_row(h, phase) * x_rhs_[bus].u()));
+                                    });
+
+            double const variance = phase_value(residual.variance, phase);
+            double const residual_variance = variance - estimated_variance;
+            if (residual_variance <= critical_residual_variance_ratio * variance) {
+                continue;
+            }
+            max_normalized_residual =
+                std::max(max_normalized_residual,
+                         cabs(phase_value(residual.residual, phase)) / std::sqrt(residual_variance * variance_scale));
+        }
+        return max_normalized_residual;
+    }
+
+    // call func(bus, h) for each bus in the measurement function h * u of the measured current
+    template <typename Func>
+    static void for_each_jacobian_entry(YBus<sym> const& y_bus, MeasurementResidual const& residual, Func&& func) {
+        MathModelParam<sym> const& param = y_bus.math_model_param();
+        switch (residual.type) {
+        case MeasurementType::voltage:
+            func(residual.obj, ComplexTensor<sym>{1.0});
+            return;
+        case MeasurementType::bus_injection:
+            for (Idx data_idx = y_bus.row_indptr()[residual.obj]; data_idx != y_bus.row_indptr()[residual.obj + 1];
+                 ++data_idx) {
+                func(y_bus.col_indices()[data_idx], y_bus.admittance()[data_idx]);
+            }
+            return;
+        case MeasurementType::shunt_power:
+            // NOTE: the negative sign for injection direction!
+            func(residual.measured_bus, ComplexTensor<sym>{-param.shunt_param[residual.obj]});
+            return;
+        default: {
+            // branch is measured at from-side: 0, to-side: 1
+            IntS const measured_side = (residual.type == MeasurementType::branch_from_power ||
+                                        residual.type == MeasurementType::branch_from_current)
+                                           ? 0
+                                           : 1;
+            for (IntS const side : std::array<IntS, 2>{0, 1}) {
+                if (Idx const bus = y_bus.math_topology().branch_bus_idx[residual.obj][side]; bus != -1) {
+                    func(bus, param.branch_param[residual.obj].value[measured_side * 2 + side]);
+                }
+            }
+            return;
+        }
+        }
+    }
+
+    // row of the measurement function of a single phase
+    static ComplexValue<sym> jacobian_row(ComplexTensor<sym> const& h, [[maybe_unused]] Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            return h;
+        } else {
+            return h.row(phase).transpose();
+        }
+    }
+
+    template <typename T> static auto phase_value(T const& value, [[maybe_unused]] Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            return value;
+        } else {
+            return value(phase);
+        }
+    }
+
     double iterate_unknown(ComplexValueVector<sym>& u, bool has_angle) {
         double max_dev = 0.0;
         // phase shift anti offset of slack bus, phase a
@@ -442,6 +710,7 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
 
 } // namespace iterative_linear_se
 
+using iterative_linear_se::BadDataDetection;
 using iterative_linear_se::IterativeLinearSESolver;
 
 } // namespace power_grid_model::math_solver
@@ -104,6 +104,9 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         if (iterative_current_pf_solver_.has_value()) {
             iterative_current_pf_solver_->parameters_changed(changed);
         }
+        if (iec60909_sc_solver_.has_value()) {
+            iec60909_sc_solver_->parameters_changed(changed);
+        }
     }
 
   private:
@@ -105,6 +105,32 @@ template <symmetry_tag sym> class MeasuredValues {
     // getter mean angle shift
     RealValue<sym> mean_angle_shift() const { return mean_angle_shift_; }
 
+    // the variance all main values are normalized with, i.e. the smallest non-zero variance
+    double variance_scale() const { return variance_scale_; }
+
+    // scale the (normalized) variance of a main value, e.g. to down-weight a measurement detected as bad data
+    // if the obj is not measured, it is undefined behaviour to call this function
+    // use checker first
+    void scale_voltage_variance(Idx bus, double factor) { voltage_main_value_[idx_voltage_[bus]].variance *= factor; }
+    void scale_bus_injection_variance(Idx bus, double factor) {
+        scale_variance(power_main_value_[bus_injection_[bus].idx_bus_injection], factor);
+    }
+    void scale_branch_from_power_variance(Idx branch, double factor) {
+        scale_variance(power_main_value_[idx_branch_from_power_[branch]], factor);
+    }
+    void scale_branch_to_power_variance(Idx branch, double factor) {
+        scale_variance(power_main_value_[idx_branch_to_power_[branch]], factor);
+    }
+    void scale_branch_from_current_variance(Idx branch, double factor) {
+        scale_variance(current_main_value_[idx_branch_from_current_[branch]].measurement, factor);
+    }
+    void scale_branch_to_current_variance(Idx branch, double factor) {
+        scale_variance(current_main_value_[idx_branch_to_current_[branch]].measurement, factor);
+    }
+    void scale_shunt_power_variance(Idx shunt, double factor) {
+        scale_variance(power_main_value_[idx_shunt_power_[shunt]], factor);
+    }
+
     // calculate load_gen and source flow
     // with given bus voltage and bus current injection
     using FlowVector = std::vector<ApplianceSolverOutput<sym>>;
@@ -213,6 +239,8 @@ template <symmetry_tag sym> class MeasuredValues {
     RealValue<sym> mean_angle_shift_;
     // the lowest bus index with a voltage measurement
     Idx first_voltage_measurement_{};
+    // the smallest non-zero variance, used to normalize the variances
+    double variance_scale_{1.0};
 
     constexpr MathModelTopology const& math_topology() const { return *math_topology_; }
 
@@ -552,6 +580,7 @@ template <symmetry_tag sym> class MeasuredValues {
         }
 
         // scale
+        variance_scale_ = min_var;
         auto const inv_norm_var = 1.0 / min_var;
         std::ranges::for_each(voltage_main_value_, [inv_norm_var](auto& x) { x.variance *= inv_norm_var; });
         std::ranges::for_each(power_main_value_, [inv_norm_var](auto& x) {
@@ -564,6 +593,11 @@ template <symmetry_tag sym> class MeasuredValues {
         });
     }
 
+    static void scale_variance(DecomposedComplexRandVar<sym>& x, double factor) {
+        x.real_component.variance *= factor;
+        x.imag_component.variance *= factor;
+    }
+
     void calculate_non_over_determined_injection(Idx n_unmeasured, IdxRange const& load_gens, IdxRange const& sources,
                                                  PowerSensorCalcParam<sym> const& bus_appliance_injection,
                                                  ComplexValue<sym> const& s, FlowVector& load_gen_flow,
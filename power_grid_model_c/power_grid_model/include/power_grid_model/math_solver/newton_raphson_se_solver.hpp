@@ -85,6 +85,12 @@ template <symmetry_tag sym> class NRSEGainBlock : public Block<double, sym, true
     BlockGetterType<1, 1, 2, 2> r() { return this->template get_block_val<1, 1, 2, 2>(); }
 };
 
+// when the gain matrix is factorized during the iterations
+enum class NRSEFactorization : IntS {
+    every_iteration = 0, // Newton-Raphson, factorize the gain matrix in every iteration
+    on_slow_convergence = 1, // quasi-Newton, reuse the factorization as long as the iterations converge fast enough
+};
+
 // solver
 template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
   public:
@@ -136,11 +142,19 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         }
     };
 
+    // in quasi-Newton mode, the gain matrix is refactorized when the maximum deviation of an iteration is more than
+    // this fraction of the maximum deviation of the previous iteration
+    static constexpr double quasi_newton_max_convergence_ratio = 0.5;
+
   public:
-    NewtonRaphsonSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr)
+    NewtonRaphsonSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr,
+                          NRSEFactorization factorization = NRSEFactorization::every_iteration)
         : n_bus_{y_bus.size()},
           math_topo_{std::move(topo_ptr)},
+          factorization_{factorization},
           data_gain_(y_bus.nnz_lu()),
+          data_gain_lu_(factorization == NRSEFactorization::every_iteration ? 0 : y_bus.nnz_lu()),
+          constant_diag_gain_(y_bus.size()),
           delta_x_rhs_(y_bus.size()),
           x_(y_bus.size()),
           sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
@@ -162,26 +176,40 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         sub_timer = Timer(calculation_info, 2221, "Pre-process measured value");
         MeasuredValues<sym> const measured_values{y_bus.shared_topology(), input};
         auto const observability_result =
-            necessary_observability_check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+            observability_cache_.check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
 
         // initialize voltage with initial angle
         sub_timer = Timer(calculation_info, 2223, "Initialize voltages");
         initialize_unknown(output.u, measured_values);
+        // the measurement weights and the constraint variances do not depend on the state
+        prepare_constant_diagonal_gain(measured_values);
 
         // loop to iterate
         Idx num_iter = 0;
+        bool refactorize = true;
         while (max_dev > err_tol || num_iter == 0) {
             if (num_iter++ == max_iter) {
                 throw IterationDiverge{max_iter, max_dev, err_tol};
             }
             sub_timer = Timer(calculation_info, 2224, "Prepare LHS rhs");
             prepare_matrix_and_rhs(y_bus, measured_values, output.u);
-            // solve with prefactorization
             sub_timer = Timer(calculation_info, 2225, "Solve sparse linear equation");
-            sparse_solver_.prefactorize_and_solve(data_gain_, perm_, delta_x_rhs_, delta_x_rhs_,
-                                                  observability_result.use_perturbation());
+            if (factorization_ == NRSEFactorization::every_iteration) {
+                // solve with prefactorization
+                sparse_solver_.prefactorize_and_solve(data_gain_, perm_, delta_x_rhs_, delta_x_rhs_,
+                                                      observability_result.use_perturbation());
+            } else {
+                // keep the assembled gain matrix intact, factorize a copy and reuse it in the next iterations
+                if (refactorize) {
+                    std::ranges::copy(data_gain_, data_gain_lu_.begin());
+                    sparse_solver_.prefactorize(data_gain_lu_, perm_, observability_result.use_perturbation());
+                }
+                sparse_solver_.solve_with_prefactorized_matrix(data_gain_lu_, perm_, delta_x_rhs_, delta_x_rhs_);
+            }
             sub_timer = Timer(calculation_info, 2226, "Iterate unknown");
+            double const last_max_dev = max_dev;
             max_dev = iterate_unknown(output.u, measured_values);
+            refactorize = max_dev > quasi_newton_max_convergence_ratio * last_max_dev;
         };
 
         // calculate math result
@@ -202,9 +230,14 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
     Idx n_bus_;
     // shared topo data
     std::shared_ptr<MathModelTopology const> math_topo_;
+    NRSEFactorization factorization_;
 
     // data for gain matrix
     std::vector<NRSEGainBlock<sym>> data_gain_;
+    // factorized gain matrix, only used when the factorization is reused across iterations
+    std::vector<NRSEGainBlock<sym>> data_gain_lu_;
+    // state independent part of the diagonal blocks of the gain matrix
+    std::vector<NRSEGainBlock<sym>> constant_diag_gain_;
     // unknown and rhs
     std::vector<NRSERhs<sym>> delta_x_rhs_;
     // voltage of current iteration
@@ -212,6 +245,8 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
     // solver
     SparseLUSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>> sparse_solver_;
     typename SparseLUSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>>::BlockPermArray perm_;
+    // observability of the previous run
+    ObservabilityCache observability_cache_;
 
     void initialize_unknown(ComplexValueVector<sym>& initial_u, MeasuredValues<sym> const& measured_values) {
         using statistics::detail::cabs_or_real;
@@ -257,7 +292,7 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
             NRSEGainBlock<sym>& diag_block = data_gain_[lu_diag[row]];
 
             rhs_block.clear();
-            diag_block.clear();
+            diag_block = constant_diag_gain_[row];
 
             NRSEVoltageState u_state{};
             u_state.ui = current_u[row];
@@ -272,10 +307,10 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
                 // get a reference and reset block to zero
                 NRSEGainBlock<sym>& block = data_gain_[data_idx_lu];
                 if (row == col) {
-                    // fill block with voltage measurement, only diagonal
-                    process_voltage_measurements(diag_block, rhs_block, measured_values, row);
+                    // fill rhs with voltage measurement, only diagonal
+                    process_voltage_measurements(rhs_block, measured_values, row);
                 } else {
-                    // Diagonal block is being cleared outside this loop
+                    // Diagonal block is being reset outside this loop
                     block.clear();
                 }
 
@@ -334,10 +369,8 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
                     auto const& yij = y_bus.admittance()[data_idx];
                     process_injection_row(block, diag_block, rhs_block, yij, u_state);
                     if (row == col) {
-                        process_injection_diagonal(block, rhs_block, measured_values.bus_injection(row));
+                        process_injection_diagonal(rhs_block, measured_values.bus_injection(row));
                     }
-                } else if (row == col) {
-                    virtually_remove_constraints(block);
                 }
             }
         }
@@ -346,6 +379,26 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         process_lagrange_multiplier(y_bus);
     }
 
+    /// @brief Prepare the part of the diagonal blocks of the gain matrix that does not depend on the state.
+    ///
+    /// These are the weights of the voltage measurements in G(i, i) and the constraint variances in R(i, i).
+    /// They only change with the measurements, so they are calculated once per state estimation instead of in every
+    /// iteration.
+    ///
+    /// @param measured_values
+    void prepare_constant_diagonal_gain(MeasuredValues<sym> const& measured_values) {
+        for (Idx bus = 0; bus != n_bus_; ++bus) {
+            NRSEGainBlock<sym>& block = constant_diag_gain_[bus];
+            block.clear();
+            process_voltage_measurement_weights(block, measured_values, bus);
+            if (measured_values.has_bus_injection(bus)) {
+                process_injection_diagonal(block, measured_values.bus_injection(bus));
+            } else {
+                virtually_remove_constraints(block);
+            }
+        }
+    }
+
     /// Q_ij = 0
     /// R_ii = -1.0, only diagonal
     /// assign -1.0 to diagonal of 3x3 tensor, for asym
@@ -356,13 +409,17 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
 
     /// R_ii = -variance, only diagonal
     /// assign variance to diagonal of 3x3 tensor, for asym
-    void process_injection_diagonal(NRSEGainBlock<sym>& block, NRSERhs<sym>& rhs_block, auto const& injection) const {
-        rhs_block.tau_p() += injection.value().real();
-        rhs_block.tau_q() += injection.value().imag();
+    void process_injection_diagonal(NRSEGainBlock<sym>& block, auto const& injection) const {
         block.r_P_theta() = RealTensor<sym>{RealValue<sym>{-injection.real_component.variance}};
         block.r_Q_v() = RealTensor<sym>{RealValue<sym>{-injection.imag_component.variance}};
     }
 
+    /// tau(i) += z_injection
+    void process_injection_diagonal(NRSERhs<sym>& rhs_block, auto const& injection) const {
+        rhs_block.tau_p() += injection.value().real();
+        rhs_block.tau_q() += injection.value().imag();
+    }
+
     /// @brief Processes common part of all elements to fill from an injection measurement.
     ///
     /// Also includes zero injection constraint.
@@ -522,20 +579,16 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
     }
 
     /// @brief G(row, row) += w_k
-    /// eta(row) += w_k . (z_k - f_k(x))
     ///
     /// In case there is no angle measurement, the slack bus or arbitray bus measurement is considered to have a virtual
     /// angle measurement of zero. w_theta = w_k by default for all measurements
     ///    angle_error = u_error / u_rated (1.0) = w_k
     ///
-    /// @param block LHS(row, col), ie. LHS(row, row)
-    /// @param rhs_block RHS(row)
+    /// @param block LHS(row, row)
     /// @param measured_values
     /// @param bus bus with voltage measurement
-    void process_voltage_measurements(NRSEGainBlock<sym>& block, NRSERhs<sym>& rhs_block,
-                                      MeasuredValues<sym> const& measured_values, Idx const& bus) {
-        using statistics::detail::cabs_or_real;
-
+    void process_voltage_measurement_weights(NRSEGainBlock<sym>& block, MeasuredValues<sym> const& measured_values,
+                                             Idx const& bus) const {
         if (!measured_values.has_voltage(bus)) {
             return;
         }
@@ -543,27 +596,51 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         // G += 1.0 / variance
         // for 3x3 tensor, fill diagonal
         auto const w_v = RealTensor<sym>{1.0 / measured_values.voltage_var(bus)};
+
+        if (measured_values.has_angle_measurement(bus) || is_virtual_angle_measurement_bus(measured_values, bus)) {
+            block.g_P_theta() += w_v;
+        }
+        block.g_Q_v() += w_v;
+    }
+
+    /// @brief eta(row) += w_k . (z_k - f_k(x))
+    ///
+    /// The weights w_k are taken from the state independent part of the gain matrix.
+    ///
+    /// @param rhs_block RHS(row)
+    /// @param measured_values
+    /// @param bus bus with voltage measurement
+    void process_voltage_measurements(NRSERhs<sym>& rhs_block, MeasuredValues<sym> const& measured_values,
+                                      Idx const& bus) {
+        using statistics::detail::cabs_or_real;
+
+        if (!measured_values.has_voltage(bus)) {
+            return;
+        }
+
+        auto& weights = constant_diag_gain_[bus];
         auto const abs_measured_v = cabs_or_real<sym>(measured_values.voltage(bus));
         auto const delta_v = abs_measured_v - x_[bus].v();
 
-        auto const virtual_angle_measurement_bus = measured_values.has_voltage(math_topo_->slack_bus)
-                                                       ? math_topo_->slack_bus
-                                                       : measured_values.first_voltage_measurement();
-
-        RealTensor<sym> w_theta{};
         RealValue<sym> delta_theta{};
         if (measured_values.has_angle_measurement(bus)) {
             delta_theta = RealValue<sym>{arg(measured_values.voltage(bus))} - RealValue<sym>{x_[bus].theta()};
-            w_theta = RealTensor<sym>{w_v};
-        } else if (bus == virtual_angle_measurement_bus && !measured_values.has_angle()) {
+        } else if (is_virtual_angle_measurement_bus(measured_values, bus)) {
             delta_theta = arg(ComplexValue<sym>{1.0}) - RealValue<sym>{x_[bus].theta()};
-            w_theta = RealTensor<sym>{w_v};
         }
 
-        block.g_P_theta() += w_theta;
-        block.g_Q_v() += w_v;
-        rhs_block.eta_theta() += dot(w_theta, delta_theta);
-        rhs_block.eta_v() += dot(w_v, delta_v);
+        rhs_block.eta_theta() += dot(weights.g_P_theta(), delta_theta);
+        rhs_block.eta_v() += dot(weights.g_Q_v(), delta_v);
+    }
+
+    bool is_virtual_angle_measurement_bus(MeasuredValues<sym> const& measured_values, Idx bus) const {
+        if (measured_values.has_angle()) {
+            return false;
+        }
+        auto const virtual_angle_measurement_bus = measured_values.has_voltage(math_topo_->slack_bus)
+                                                       ? math_topo_->slack_bus
+                                                       : measured_values.first_voltage_measurement();
+        return bus == virtual_angle_measurement_bus;
     }
 
     /// @brief The second part to add to the F_k(u1, u1, y11) block for shunt flow.
@@ -661,7 +738,7 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         return conj(yij) * ui_uj_conj;
     }
 
-    double iterate_unknown(ComplexValueVector<sym>& u, MeasuredValues<sym> measured_values) {
+    double iterate_unknown(ComplexValueVector<sym>& u, MeasuredValues<sym> const& measured_values) {
         double max_dev = 0.0;
         // phase shift anti offset of slack bus, phase a
         // if no angle measurement is present
@@ -710,5 +787,6 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
 } // namespace newton_raphson_se
 
 using newton_raphson_se::NewtonRaphsonSESolver;
+using newton_raphson_se::NRSEFactorization;
 
 } // namespace power_grid_model::math_solver
@@ -9,6 +9,9 @@
 
 #include "../common/exception.hpp"
 
+#include <numeric>
+#include <optional>
+
 namespace power_grid_model::math_solver {
 
 namespace detail {
@@ -121,6 +124,148 @@ inline void assign_injection_sensor_radial(YBusStructure const& y_bus_structure,
     flow_sensors[y_bus_structure.bus_entry[n_bus - 1]] = 0;
 }
 
+// whether a current sensor with a global angle measurement is on either side of the branch
+template <symmetry_tag sym>
+bool has_branch_global_angle_current(MeasuredValues<sym> const& measured_values, Idx branch) {
+    return (measured_values.has_branch_from_current(branch) &&
+            measured_values.branch_from_current(branch).angle_measurement_type == AngleMeasurementType::global_angle) ||
+           (measured_values.has_branch_to_current(branch) &&
+            measured_values.branch_to_current(branch).angle_measurement_type == AngleMeasurementType::global_angle);
+}
+
+// disjoint sets of buses, with path halving and union by size
+class BusIslands {
+  public:
+    explicit BusIslands(Idx n_bus) : parent_(n_bus), size_(n_bus, 1), n_islands_{n_bus} {
+        std::iota(parent_.begin(), parent_.end(), Idx{0});
+    }
+
+    Idx n_islands() const { return n_islands_; }
+
+    Idx find(Idx bus) {
+        while (parent_[bus] != bus) {
+            parent_[bus] = parent_[parent_[bus]];
+            bus = parent_[bus];
+        }
+        return bus;
+    }
+
+    // return true if the buses were in different islands
+    bool unite(Idx bus_1, Idx bus_2) {
+        Idx root_1 = find(bus_1);
+        Idx root_2 = find(bus_2);
+        if (root_1 == root_2) {
+            return false;
+        }
+        if (size_[root_1] < size_[root_2]) {
+            std::swap(root_1, root_2);
+        }
+        parent_[root_2] = root_1;
+        size_[root_1] += size_[root_2];
+        --n_islands_;
+        return true;
+    }
+
+  private:
+    IdxVector parent_;
+    IdxVector size_;
+    Idx n_islands_;
+};
+
+// topological observability check of meshed grids, based on the islands of buses connected by measured branches
+// within such a flow island all voltage angles are known relative to each other
+//
+// an injection sensor only adds information if its bus is adjacent to another flow island, and it can join at most
+// two islands. therefore, the following is a necessary condition:
+//     the islands without voltage phasor sensor (apart from one reference island if there is no phasor at all)
+//     must not outnumber the injection sensors adjacent to another island
+//
+// if there is no voltage phasor sensor, the injection sensors are then greedily assigned to a branch towards
+// another island. if this joins all buses into one island, a spanning tree of independent measurements exists and
+// the grid is observable (sufficient condition). the greedy assignment can miss a valid assignment, so failing to
+// join all islands is not conclusive.
+//
+// return whether the sufficient condition is met
+template <symmetry_tag sym>
+bool check_meshed_observable_islands(MeasuredValues<sym> const& measured_values, MathModelTopology const& topo,
+                                     YBusStructure const& y_bus_structure) {
+    Idx const n_bus{topo.n_bus()};
+    BusIslands islands{n_bus};
+
+    // join the islands by the fully connected measured branches
+    std::vector<bool> anchored_branch(topo.n_branch(), false);
+    for (Idx branch = 0; branch != topo.n_branch(); ++branch) {
+        auto const [bus_from, bus_to] = topo.branch_bus_idx[branch];
+        if (bus_from == -1 || bus_to == -1) {
+            continue;
+        }
+        if (measured_values.has_branch_from_power(branch) || measured_values.has_branch_to_power(branch) ||
+            measured_values.has_branch_from_current(branch) || measured_values.has_branch_to_current(branch)) {
+            islands.unite(bus_from, bus_to);
+        }
+        // a global angle current sensor also references the angle of its island
+        anchored_branch[branch] = has_branch_global_angle_current(measured_values, branch);
+    }
+
+    // islands with an absolute angle reference
+    std::vector<bool> anchored(n_bus, false);
+    for (Idx bus = 0; bus != n_bus; ++bus) {
+        if (measured_values.has_voltage(bus) && measured_values.has_angle_measurement(bus)) {
+            anchored[islands.find(bus)] = true;
+        }
+    }
+    for (Idx branch = 0; branch != topo.n_branch(); ++branch) {
+        if (anchored_branch[branch]) {
+            anchored[islands.find(topo.branch_bus_idx[branch][0])] = true;
+        }
+    }
+    Idx n_anchored_islands{};
+    for (Idx bus = 0; bus != n_bus; ++bus) {
+        if (anchored[bus] && islands.find(bus) == bus) {
+            ++n_anchored_islands;
+        }
+    }
+
+    // a bus injection sensor is useful if the bus is adjacent to another island
+    auto const is_adjacent_to_other_island = [&islands, &y_bus_structure](Idx bus) {
+        for (Idx ybus_index = y_bus_structure.row_indptr[bus]; ybus_index != y_bus_structure.row_indptr[bus + 1];
+             ++ybus_index) {
+            if (islands.find(y_bus_structure.col_indices[ybus_index]) != islands.find(bus)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    Idx n_useful_injection{};
+    for (Idx bus = 0; bus != n_bus; ++bus) {
+        if (measured_values.has_bus_injection(bus) && is_adjacent_to_other_island(bus)) {
+            ++n_useful_injection;
+        }
+    }
+    if (n_useful_injection < islands.n_islands() - std::max(n_anchored_islands, Idx{1})) {
+        throw NotObservableError{"The measured branches split the grid into more islands than the power/current "
+                                 "sensors can connect. The system is not observable.\n"};
+    }
+    if (n_anchored_islands > 0) {
+        return false;
+    }
+
+    // greedily assign the injection sensors to a branch towards another island
+    // an injection sensor of which all neighbours are in its own island stays useless, so one pass is enough
+    for (Idx bus = 0; bus != n_bus && islands.n_islands() > 1; ++bus) {
+        if (!measured_values.has_bus_injection(bus)) {
+            continue;
+        }
+        for (Idx ybus_index = y_bus_structure.row_indptr[bus]; ybus_index != y_bus_structure.row_indptr[bus + 1];
+             ++ybus_index) {
+            if (islands.unite(bus, y_bus_structure.col_indices[ybus_index])) {
+                break;
+            }
+        }
+    }
+    return islands.n_islands() == 1;
+}
+
 } // namespace detail
 
 struct ObservabilityResult {
@@ -174,8 +319,85 @@ inline ObservabilityResult necessary_observability_check(MeasuredValues<sym> con
         }
         result.is_sufficiently_observable = true;
     }
+    // for meshed grid, check the islands connected by measured branches
+    else if (!topo.is_radial) {
+        result.is_sufficiently_observable =
+            detail::check_meshed_observable_islands(measured_values, topo, y_bus_structure);
+    }
 
     return result;
 }
 
+// cache of the necessary observability check of one math model
+// the observability only depends on which quantities are measured, not on the measured values
+// therefore the result is reused as long as the same quantities are measured, e.g. in the scenarios of a batch
+// the cache is only valid for the topology it is used with; a new topology requires a new cache
+class ObservabilityCache {
+  public:
+    template <symmetry_tag sym>
+    ObservabilityResult check(MeasuredValues<sym> const& measured_values, MathModelTopology const& topo,
+                              YBusStructure const& y_bus_structure) {
+        build_signature(measured_values, topo, new_signature_);
+        if (result_.has_value() && new_signature_ == signature_) {
+            return result_.value();
+        }
+        // only a successful check is cached, so an unobservable system throws every time
+        result_.reset();
+        ObservabilityResult const result = necessary_observability_check(measured_values, topo, y_bus_structure);
+        signature_.swap(new_signature_);
+        result_ = result;
+        return result;
+    }
+
+  private:
+    // per bus: voltage, voltage angle and bus injection
+    // per branch: any flow measured on either side, and a global angle current sensor on either side,
+    //     which determines the island that gets an angle reference
+    enum SignatureFlag : int8_t {
+        voltage = 0x01,
+        voltage_angle = 0x02,
+        bus_injection = 0x04,
+        branch_flow = 0x08,
+        global_angle_current = 0x10
+    };
+
+    std::vector<int8_t> signature_;
+    std::vector<int8_t> new_signature_;
+    std::optional<ObservabilityResult> result_;
+
+    template <symmetry_tag sym>
+    static void build_signature(MeasuredValues<sym> const& measured_values, MathModelTopology const& topo,
+                                std::vector<int8_t>& signature) {
+        Idx const n_bus = topo.n_bus();
+        Idx const n_branch = topo.n_branch();
+        signature.resize(n_bus + n_branch);
+        for (Idx bus = 0; bus != n_bus; ++bus) {
+            int8_t flags{};
+            if (measured_values.has_voltage(bus)) {
+                flags |= voltage;
+                if (measured_values.has_angle_measurement(bus)) {
+                    flags |= voltage_angle;
+                }
+            }
+            if (measured_values.has_bus_injection(bus)) {
+                flags |= bus_injection;
+            }
+            signature[bus] = flags;
+        }
+        for (Idx branch = 0; branch != n_branch; ++branch) {
+            bool const measured =
+                measured_values.has_branch_from_power(branch) || measured_values.has_branch_to_power(branch) ||
+                measured_values.has_branch_from_current(branch) || measured_values.has_branch_to_current(branch);
+            int8_t flags{};
+            if (measured) {
+                flags |= branch_flow;
+                if (detail::has_branch_global_angle_current(measured_values, branch)) {
+                    flags |= global_angle_current;
+                }
+            }
+            signature[n_bus + branch] = flags;
+        }
+    }
+};
+
 } // namespace power_grid_model::math_solver
@@ -29,7 +29,9 @@ template <symmetry_tag sym> class ShortCircuitSolver {
           sources_per_bus_{topo_ptr, &topo_ptr->sources_per_bus},
           mat_data_(y_bus.nnz_lu()),
           sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
-          perm_{static_cast<BlockPermArray>(n_bus_)} {}
+          perm_{static_cast<BlockPermArray>(n_bus_)},
+          prefault_sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          prefault_perm_{static_cast<BlockPermArray>(n_bus_)} {}
 
     ShortCircuitSolverOutput<sym> run_short_circuit(YBus<sym> const& y_bus, ShortCircuitInput const& input) {
         check_input_valid(input);
@@ -47,12 +49,17 @@ template <symmetry_tag sym> class ShortCircuitSolver {
 
         IdxVector infinite_admittance_fault_counter(n_bus_);
 
-        detail::copy_y_bus<sym>(y_bus, mat_data_);
+        if (is_low_rank_fault(input, fault_type)) {
+            solve_with_prefault_factorization(y_bus, input, output, fault_type, phase_1, phase_2);
+        } else {
+            detail::copy_y_bus<sym>(y_bus, mat_data_);
 
-        prepare_matrix_and_rhs(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1, phase_2);
+            prepare_matrix_and_rhs(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1,
+                                   phase_2);
 
-        // solve matrix
-        sparse_solver_.prefactorize_and_solve(mat_data_, perm_, output.u_bus, output.u_bus);
+            // solve matrix
+            sparse_solver_.prefactorize_and_solve(mat_data_, perm_, output.u_bus, output.u_bus);
+        }
 
         // post processing
         calculate_result(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1, phase_2);
@@ -60,7 +67,14 @@ template <symmetry_tag sym> class ShortCircuitSolver {
         return output;
     }
 
+    // the pre-fault factorization is invalid when the parameters of the y bus change
+    void parameters_changed(bool changed) { prefault_factorized_ = prefault_factorized_ && !changed; }
+
   private:
+    static constexpr Idx n_phase = is_symmetric_v<sym> ? 1 : 3;
+    // maximum number of faulted bus phases for which the faults are solved as a modification of the pre-fault matrix
+    static constexpr Idx max_low_rank_fault_size = 64;
+
     Idx n_bus_;
     Idx n_source_;
     // shared topo data
@@ -70,6 +84,161 @@ template <symmetry_tag sym> class ShortCircuitSolver {
     // sparse solver
     SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>> sparse_solver_;
     BlockPermArray perm_;
+    // factorization of the pre-fault matrix (y bus and source admittances), kept over consecutive calculations
+    ComplexTensorVector<sym> prefault_mat_data_;
+    SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>> prefault_sparse_solver_;
+    BlockPermArray prefault_perm_;
+    bool prefault_factorized_{false};
+    // response A^-1 * e of the pre-fault matrix A to a unit injection e at each phase of the faulted buses,
+    // and the Thevenin impedance matrix of the faulted bus phases, kept while the faulted buses are the same
+    IdxVector fault_response_buses_;
+    std::vector<ComplexValueVector<sym>> fault_response_;
+    Eigen::MatrixXcd fault_thevenin_impedance_;
+
+    // faults with a finite admittance only add the fault admittances to the diagonal of the faulted buses:
+    //    A_fault = A + U * C * U^T
+    // where A is the pre-fault matrix, U selects the phases of the faulted buses and C contains the fault admittances
+    // this holds for all fault types except two phase to ground faults, which change the variables of the system
+    static bool is_low_rank_fault(ShortCircuitInput const& input, FaultType fault_type) {
+        if (fault_type == FaultType::two_phase_to_ground ||
+            std::ranges::any_of(input.faults,
+                                [](FaultCalcParam const& fault) { return std::isinf(fault.y_fault.real()); })) {
+            return false;
+        }
+        Idx n_faulted_bus{0};
+        for (auto const& [bus_number, faults] : enumerated_zip_sequence(input.fault_buses)) {
+            n_faulted_bus += std::empty(faults) ? 0 : 1;
+        }
+        return n_faulted_bus * n_phase <= max_low_rank_fault_size;
+    }
+
+    // solve A_fault * u = rhs with the Woodbury identity
+    //    A_fault^-1 = A^-1 - A^-1 * U * C * (I + Z * C)^-1 * U^T * A^-1,    Z = U^T * A^-1 * U
+    // the factorization of A and the fault response A^-1 * U are reused, so sweeps over the fault impedance and the
+    // fault type at the same buses only need one solve with the pre-factorized matrix and a small dense solve
+    void solve_with_prefault_factorization(YBus<sym> const& y_bus, ShortCircuitInput const& input,
+                                           ShortCircuitSolverOutput<sym>& output, FaultType fault_type, IntS phase_1,
+                                           IntS phase_2) {
+        if (!prefault_factorized_) {
+            factorize_prefault_matrix(y_bus);
+        }
+
+        // pre-fault voltage u_0 = A^-1 * rhs
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(*sources_per_bus_)) {
+            for (Idx const source_number : sources) {
+                ComplexTensor<sym> const y_source =
+                    y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
+                output.u_bus[bus_number] += dot(y_source, ComplexValue<sym>{input.source[source_number]});
+            }
+        }
+        prefault_sparse_solver_.solve_with_prefactorized_matrix(prefault_mat_data_, prefault_perm_, output.u_bus,
+                                                                output.u_bus);
+
+        // fault admittances per faulted bus
+        IdxVector faulted_buses;
+        std::vector<Eigen::MatrixXcd> bus_fault_admittance;
+        for (auto const& [bus_number, faults] : enumerated_zip_sequence(input.fault_buses)) {
+            if (std::empty(faults)) {
+                continue;
+            }
+            faulted_buses.push_back(bus_number);
+            Eigen::MatrixXcd& y_fault_bus =
+                bus_fault_admittance.emplace_back(Eigen::MatrixXcd::Zero(n_phase, n_phase));
+            for (Idx const fault_number : faults) {
+                add_fault_admittance(y_fault_bus, input.faults[fault_number].y_fault, fault_type, phase_1, phase_2);
+            }
+        }
+        if (faulted_buses.empty()) {
+            return;
+        }
+        if (faulted_buses != fault_response_buses_) {
+            calculate_fault_response(std::move(faulted_buses));
+        }
+
+        auto const n_fault_size = std::ssize(fault_response_);
+        Eigen::MatrixXcd y_fault = Eigen::MatrixXcd::Zero(n_fault_size, n_fault_size);
+        Eigen::VectorXcd u_fault(n_fault_size);
+        for (Idx bus_idx = 0; bus_idx != std::ssize(fault_response_buses_); ++bus_idx) {
+            y_fault.block(bus_idx * n_phase, bus_idx * n_phase, n_phase, n_phase) = bus_fault_admittance[bus_idx];
+            for (Idx phase = 0; phase != n_phase; ++phase) {
+                u_fault(bus_idx * n_phase + phase) = phase_entry(output.u_bus[fault_response_buses_[bus_idx]], phase);
+            }
+        }
+        Eigen::MatrixXcd const system =
+            Eigen::MatrixXcd::Identity(n_fault_size, n_fault_size) + fault_thevenin_impedance_ * y_fault;
+        Eigen::VectorXcd const i_fault = y_fault * system.partialPivLu().solve(u_fault);
+
+        // u = u_0 - A^-1 * U * i_fault
+        for (Idx column = 0; column != n_fault_size; ++column) {
+            DoubleComplex const i_fault_column = i_fault(column);
+            ComplexValueVector<sym> const& response = fault_response_[column];
+            for (Idx bus = 0; bus != n_bus_; ++bus) {
+                output.u_bus[bus] -= response[bus] * i_fault_column;
+            }
+        }
+    }
+
+    void factorize_prefault_matrix(YBus<sym> const& y_bus) {
+        prefault_mat_data_.resize(y_bus.nnz_lu());
+        detail::copy_y_bus<sym>(y_bus, prefault_mat_data_);
+        IdxVector const& bus_entry = y_bus.lu_diag();
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(*sources_per_bus_)) {
+            for (Idx const source_number : sources) {
+                prefault_mat_data_[bus_entry[bus_number]] +=
+                    y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
+            }
+        }
+        prefault_sparse_solver_.prefactorize(prefault_mat_data_, prefault_perm_);
+        prefault_factorized_ = true;
+        fault_response_buses_.clear();
+        fault_response_.clear();
+    }
+
+    void calculate_fault_response(IdxVector faulted_buses) {
+        fault_response_buses_ = std::move(faulted_buses);
+        auto const n_fault_size = std::ssize(fault_response_buses_) * n_phase;
+        fault_response_.assign(n_fault_size, ComplexValueVector<sym>(n_bus_));
+        for (Idx column = 0; column != n_fault_size; ++column) {
+            ComplexValueVector<sym>& response = fault_response_[column];
+            phase_entry(response[fault_response_buses_[column / n_phase]], column % n_phase) = 1.0;
+            prefault_sparse_solver_.solve_with_prefactorized_matrix(prefault_mat_data_, prefault_perm_, response,
+                                                                    response);
+        }
+        fault_thevenin_impedance_.resize(n_fault_size, n_fault_size);
+        for (Idx row = 0; row != n_fault_size; ++row) {
+            for (Idx column = 0; column != n_fault_size; ++column) {
+                fault_thevenin_impedance_(row, column) =
+                    phase_entry(fault_response_[column][fault_response_buses_[row / n_phase]], row % n_phase);
+            }
+        }
+    }
+
+    // same admittance pattern as add_fault
+    static void add_fault_admittance(Eigen::MatrixXcd& y_fault_bus, DoubleComplex const& y_fault,
+                                     FaultType fault_type, IntS phase_1, IntS phase_2) {
+        using enum FaultType;
+
+        if (fault_type == three_phase) {
+            y_fault_bus.diagonal().array() += y_fault;
+        } else if (fault_type == single_phase_to_ground) {
+            y_fault_bus(phase_1, phase_1) += y_fault;
+        } else if (fault_type == two_phase) {
+            y_fault_bus(phase_1, phase_1) += y_fault;
+            y_fault_bus(phase_2, phase_2) += y_fault;
+            y_fault_bus(phase_1, phase_2) -= y_fault;
+            y_fault_bus(phase_2, phase_1) -= y_fault;
+        } else {
+            assert(false);
+        }
+    }
+
+    template <typename T> static decltype(auto) phase_entry(T&& value, [[maybe_unused]] Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            return std::forward<T>(value);
+        } else {
+            return std::forward<T>(value)(phase);
+        }
+    }
 
     void prepare_matrix_and_rhs(YBus<sym> const& y_bus, ShortCircuitInput const& input,
                                 ShortCircuitSolverOutput<sym>& output, IdxVector& infinite_admittance_fault_counter,
@@ -53,6 +53,8 @@ template <rk2_tensor Matrix> class DenseLUFactor {
     struct BlockPerm {
         PermutationType p;
         PermutationType q;
+        // the block is factorized without pivoting, p and q are not set and should not be applied
+        bool no_pivoting{false};
     };
 
     // factorize in place
@@ -65,6 +67,59 @@ template <rk2_tensor Matrix> class DenseLUFactor {
         requires(std::same_as<typename Derived::Scalar, Scalar> && rk2_tensor<Derived> &&
                  (Derived::RowsAtCompileTime == size) && (Derived::ColsAtCompileTime == size))
     {
+        // fast path for diagonally dominant blocks, which is typical for the Y-bus of passive networks
+        block_perm.no_pivoting =
+            is_column_diagonally_dominant(matrix) && factorize_block_without_pivoting(matrix, perturb_threshold);
+        if (!block_perm.no_pivoting) {
+            factorize_block_with_full_pivoting(matrix, block_perm, perturb_threshold, use_pivot_perturbation,
+                                               has_pivot_perturbation);
+        }
+        capturing::into_the_void(std::move(matrix));
+    }
+
+  private:
+    // strictly diagonally dominant by columns: |a_jj| > sum_{i != j} |a_ij| for every column j
+    // Gaussian elimination without pivoting is then stable, all multipliers in L are bounded by one,
+    //    and the property is preserved in the remaining bottom right corner
+    template <class Derived> static bool is_column_diagonally_dominant(Eigen::MatrixBase<Derived> const& matrix) {
+        auto const abs_matrix = matrix.cwiseAbs().eval();
+        return ((2.0 * abs_matrix.diagonal().transpose().array()) > abs_matrix.colwise().sum().array()).all();
+    }
+
+    // factorize in place without any pivot search or swap
+    // safety check: if any pivot would need perturbation or violates the condition number check,
+    //    the original matrix is restored and false is returned, so the caller can fall back to full pivoting
+    template <class Derived>
+    static bool factorize_block_without_pivoting(Eigen::MatrixBase<Derived>& matrix, double perturb_threshold) {
+        Matrix const original = matrix;
+        double max_pivot{};
+        for (int8_t pivot = 0; pivot != size; ++pivot) {
+            double const abs_pivot = cabs(matrix(pivot, pivot));
+            if (abs_pivot < perturb_threshold || !is_normal(matrix(pivot, pivot))) {
+                matrix = original;
+                return false;
+            }
+            max_pivot = std::max(max_pivot, abs_pivot);
+            if (pivot < size - 1) {
+                matrix.col(pivot).tail(size - pivot - 1) /= matrix(pivot, pivot);
+                matrix.bottomRightCorner(size - pivot - 1, size - pivot - 1).noalias() -=
+                    matrix.col(pivot).tail(size - pivot - 1) * matrix.row(pivot).tail(size - pivot - 1);
+            }
+        }
+        double const pivot_threshold = epsilon * max_pivot;
+        for (int8_t pivot = 0; pivot != size; ++pivot) {
+            if (cabs(matrix(pivot, pivot)) < pivot_threshold) {
+                matrix = original;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class Derived>
+    static void factorize_block_with_full_pivoting(Eigen::MatrixBase<Derived>& matrix, BlockPerm& block_perm,
+                                                   double perturb_threshold, bool use_pivot_perturbation,
+                                                   bool& has_pivot_perturbation) {
         TranspositionVector row_transpositions{};
         TranspositionVector col_transpositions{};
         double max_pivot{};
@@ -138,7 +193,6 @@ template <rk2_tensor Matrix> class DenseLUFactor {
                 throw SparseMatrixError{}; // can not specify error code
             }
         }
-        capturing::into_the_void(std::move(matrix));
     }
 };
 
@@ -296,16 +350,19 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
             if constexpr (is_block) {
                 // loop rows and columns at the same time
                 // since the matrix is symmetric
+                // nothing to permute if the pivot is factorized without pivoting
                 for (Idx l_idx = row_indptr[pivot_row_col]; l_idx < pivot_idx; ++l_idx) {
-                    // permute rows of L_k,pivot
-                    lu_matrix[l_idx] = (block_perm.p * lu_matrix[l_idx].matrix()).array();
                     // get row and idx of u
                     Idx const u_row = col_indices[l_idx];
                     Idx const u_idx = col_position_idx[u_row];
                     // we should exactly find the current column
                     assert(col_indices[u_idx] == pivot_row_col);
-                    // permute columns of U_pivot,k
-                    lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q).array();
+                    if (!block_perm.no_pivoting) {
+                        // permute rows of L_k,pivot
+                        lu_matrix[l_idx] = (block_perm.p * lu_matrix[l_idx].matrix()).array();
+                        // permute columns of U_pivot,k
+                        lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q).array();
+                    }
                     // increment column position
                     ++col_position_idx[u_row];
                 }
@@ -318,7 +375,9 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                 for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr[pivot_row_col + 1]; ++u_idx) {
                     Tensor& u = lu_matrix[u_idx];
                     // permutation
-                    u = (block_perm.p * u.matrix()).array();
+                    if (!block_perm.no_pivoting) {
+                        u = (block_perm.p * u.matrix()).array();
+                    }
                     // forward substitution, per row in u
                     for (Idx block_row = 0; block_row < block_size; ++block_row) {
                         for (Idx block_col = 0; block_col < block_row; ++block_col) {
@@ -346,7 +405,9 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                     // L_k,pivot * U_pivot = A_k_pivot * Q_pivot    k > pivot
                     Tensor& l = lu_matrix[l_idx];
                     // permutation
-                    l = (l.matrix() * block_perm.q).array();
+                    if (!block_perm.no_pivoting) {
+                        l = (l.matrix() * block_perm.q).array();
+                    }
                     // forward substitution, per column in l
                     // l0 = [l00, l10]^T
                     // l1 = [l01, l11]^T
@@ -581,7 +642,11 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         for (Idx row = 0; row != size_; ++row) {
             // permutation if needed
             if constexpr (is_block) {
-                x[row] = (block_perm_array[row].p * rhs[row].matrix()).array();
+                if (block_perm_array[row].no_pivoting) {
+                    x[row] = rhs[row];
+                } else {
+                    x[row] = (block_perm_array[row].p * rhs[row].matrix()).array();
+                }
             } else {
                 x[row] = rhs[row];
             }
@@ -634,7 +699,9 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         // restore permutation for block matrix
         if constexpr (is_block) {
             for (Idx row = 0; row != size_; ++row) {
-                x[row] = (block_perm_array[row].q * x[row].matrix()).array();
+                if (!block_perm_array[row].no_pivoting) {
+                    x[row] = (block_perm_array[row].q * x[row].matrix()).array();
+                }
             }
         }
     }
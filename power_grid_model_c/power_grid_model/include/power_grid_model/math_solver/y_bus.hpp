@@ -274,6 +274,170 @@ struct YBusStructure {
     }
 };
 
+// admittances and buses of elements with n_port terminals (branch: 2, shunt: 1) for the vectorized flow calculation
+// the elements are grouped in blocks of block_size elements
+// within a block, the real and imaginary parts of each entry of each admittance tensor are stored contiguously,
+// so the inner loops over the elements of a block have a fixed length and are vectorized by the compiler,
+// while all data of a block stays close together in memory
+template <symmetry_tag sym, Idx n_port> class ElementAdmittanceArrays {
+  public:
+    static constexpr Idx n_phase = is_symmetric_v<sym> ? 1 : 3;
+    static constexpr Idx n_entry = n_port * n_port * n_phase * n_phase;
+    static constexpr Idx n_terminal_phase = n_port * n_phase;
+    static constexpr Idx block_size = 8;
+    using ElementAdmittance = std::array<ComplexTensor<sym>, n_port * n_port>;
+    using ElementBus = std::array<Idx, n_port>;
+
+    Idx size() const { return n_element_; }
+
+    // set the buses of all elements, -1 for a disconnected port
+    // the admittances are reset to zero
+    void set_buses(std::vector<ElementBus> const& buses) {
+        n_element_ = std::ssize(buses);
+        data_.assign((n_element_ + block_size - 1) / block_size, Block{});
+        for (Idx element = 0; element != n_element_; ++element) {
+            Block& block = data_[element / block_size];
+            Idx const lane = element % block_size;
+            for (Idx port = 0; port != n_port; ++port) {
+                // a disconnected port gathers the voltage of bus 0, which is masked out
+                Idx const bus = buses[element][port];
+                block.bus[port][lane] = bus == -1 ? 0 : bus;
+                block.connected[port][lane] = bus == -1 ? 0.0 : 1.0;
+            }
+        }
+    }
+
+    // admittance[p * n_port + q] is the admittance from the voltage at port q to the current at port p
+    void set_admittance(Idx element, ElementAdmittance const& admittance) {
+        Block& block = data_[element / block_size];
+        Idx const lane = element % block_size;
+        for (Idx port_i = 0; port_i != n_port; ++port_i) {
+            for (Idx port_u = 0; port_u != n_port; ++port_u) {
+                for (Idx row = 0; row != n_phase; ++row) {
+                    for (Idx col = 0; col != n_phase; ++col) {
+                        DoubleComplex const y = tensor_entry(admittance[port_i * n_port + port_u], row, col);
+                        Idx const entry = entry_idx(port_i, port_u, row, col);
+                        block.real[entry][lane] = y.real();
+                        block.imag[entry][lane] = y.imag();
+                    }
+                }
+            }
+        }
+    }
+
+    // calculate the currents i_p = sum_q y_pq * u_q and the powers s_p = u_p * conj(i_p) of all elements at all ports
+    // a disconnected port has zero voltage
+    // the results are written to the given members of the output of each element, the power only if requested
+    template <bool with_power, typename Output>
+    void calculate_flow(ComplexValueVector<sym> const& u, std::vector<Output>& output,
+                        std::array<ComplexValue<sym> Output::*, n_port> const& current,
+                        std::array<ComplexValue<sym> Output::*, n_port> const& power = {}) const {
+        assert(std::ssize(output) == n_element_);
+        for (Idx block_idx = 0; block_idx != std::ssize(data_); ++block_idx) {
+            Block const& block = data_[block_idx];
+
+            // gather the voltages
+            Lanes u_real[n_terminal_phase];
+            Lanes u_imag[n_terminal_phase];
+            for (Idx port = 0; port != n_port; ++port) {
+                for (Idx lane = 0; lane != block_size; ++lane) {
+                    ComplexValue<sym> const& u_bus = u[block.bus[port][lane]];
+                    for (Idx phase = 0; phase != n_phase; ++phase) {
+                        u_real[port * n_phase + phase][lane] =
+                            value_entry(u_bus, phase).real() * block.connected[port][lane];
+                        u_imag[port * n_phase + phase][lane] =
+                            value_entry(u_bus, phase).imag() * block.connected[port][lane];
+                    }
+                }
+            }
+
+            // accumulate the complex products over the lanes
+            Lanes i_real[n_terminal_phase]{};
+            Lanes i_imag[n_terminal_phase]{};
+            for (Idx port_i = 0; port_i != n_port; ++port_i) {
+                for (Idx port_u = 0; port_u != n_port; ++port_u) {
+                    for (Idx row = 0; row != n_phase; ++row) {
+                        for (Idx col = 0; col != n_phase; ++col) {
+                            Idx const entry = entry_idx(port_i, port_u, row, col);
+                            Idx const terminal_u = port_u * n_phase + col;
+                            Idx const terminal_i = port_i * n_phase + row;
+                            for (Idx lane = 0; lane != block_size; ++lane) {
+                                i_real[terminal_i][lane] += block.real[entry][lane] * u_real[terminal_u][lane] -
+                                                            block.imag[entry][lane] * u_imag[terminal_u][lane];
+                                i_imag[terminal_i][lane] += block.real[entry][lane] * u_imag[terminal_u][lane] +
+                                                            block.imag[entry][lane] * u_real[terminal_u][lane];
+                            }
+                        }
+                    }
+                }
+            }
+
+            // s = u * conj(i) over the lanes
+            Lanes s_real[n_terminal_phase];
+            Lanes s_imag[n_terminal_phase];
+            for (Idx terminal = 0; terminal != (with_power ? n_terminal_phase : 0); ++terminal) {
+                for (Idx lane = 0; lane != block_size; ++lane) {
+                    s_real[terminal][lane] =
+                        u_real[terminal][lane] * i_real[terminal][lane] + u_imag[terminal][lane] * i_imag[terminal][lane];
+                    s_imag[terminal][lane] =
+                        u_imag[terminal][lane] * i_real[terminal][lane] - u_real[terminal][lane] * i_imag[terminal][lane];
+                }
+            }
+
+            // scatter the currents and powers
+            Idx const begin = block_idx * block_size;
+            Idx const n_lane = std::min(block_size, n_element_ - begin);
+            for (Idx lane = 0; lane != n_lane; ++lane) {
+                Output& element_output = output[begin + lane];
+                for (Idx port = 0; port != n_port; ++port) {
+                    for (Idx phase = 0; phase != n_phase; ++phase) {
+                        Idx const terminal = port * n_phase + phase;
+                        value_entry(element_output.*current[port], phase) =
+                            DoubleComplex{i_real[terminal][lane], i_imag[terminal][lane]};
+                        if constexpr (with_power) {
+                            value_entry(element_output.*power[port], phase) =
+                                DoubleComplex{s_real[terminal][lane], s_imag[terminal][lane]};
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+  private:
+    template <typename T> using Lanes_t = std::array<T, block_size>;
+    using Lanes = Lanes_t<double>;
+    struct Block {
+        std::array<Lanes, n_entry> real{};
+        std::array<Lanes, n_entry> imag{};
+        std::array<Lanes_t<Idx>, n_port> bus{};
+        std::array<Lanes, n_port> connected{};
+    };
+
+    Idx n_element_{};
+    std::vector<Block> data_;
+
+    static constexpr Idx entry_idx(Idx port_i, Idx port_u, Idx row, Idx col) {
+        return ((port_i * n_port + port_u) * n_phase + row) * n_phase + col;
+    }
+
+    static DoubleComplex tensor_entry(ComplexTensor<sym> const& y, [[maybe_unused]] Idx row,
+                                      [[maybe_unused]] Idx col) {
+        if constexpr (is_symmetric_v<sym>) {
+            return y;
+        } else {
+            return y(row, col);
+        }
+    }
+    template <typename T> static decltype(auto) value_entry(T&& x, [[maybe_unused]] Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            return std::forward<T>(x);
+        } else {
+            return std::forward<T>(x)(phase);
+        }
+    }
+};
+
 // See also "Node Admittance Matrix" in "State Estimation Alliander"
 template <symmetry_tag sym> class YBus {
   public:
@@ -282,6 +446,10 @@ template <symmetry_tag sym> class YBus {
     YBus(std::shared_ptr<MathModelTopology const> const& topo_ptr,
          std::shared_ptr<MathModelParam<sym> const> const& param,
          std::shared_ptr<YBusStructure const> const& y_bus_struct = {})
+        : YBus{topo_ptr, *param, y_bus_struct} {}
+
+    YBus(std::shared_ptr<MathModelTopology const> const& topo_ptr, MathModelParam<sym> const& param,
+         std::shared_ptr<YBusStructure const> const& y_bus_struct = {})
         : math_topology_{topo_ptr} {
         // use existing struct or make new struct
         if (y_bus_struct) {
@@ -306,7 +474,7 @@ template <symmetry_tag sym> class YBus {
     std::vector<YBusElement> const& y_bus_element() const { return y_bus_struct_->y_bus_element; }
     IdxVector const& y_bus_entry_indptr() const { return y_bus_struct_->y_bus_entry_indptr; }
     MathModelTopology const& math_topology() const { return *math_topology_; }
-    MathModelParam<sym> const& math_model_param() const { return *math_model_param_; }
+    MathModelParam<sym> const& math_model_param() const { return math_model_param_; }
 
     ComplexTensorVector<sym> const& admittance() const { return admittance_; }
     IdxVector const& bus_entry() const { return y_bus_struct_->bus_entry; }
@@ -332,58 +500,71 @@ template <symmetry_tag sym> class YBus {
     IdxVector const& get_shunt_param_idx() const { return shunt_param_idx_; }
 
     void update_admittance(std::shared_ptr<MathModelParam<sym> const> const& math_model_param) {
-        // overwrite the old cached parameters
+        update_admittance(*math_model_param);
+    }
+
+    void update_admittance(MathModelParam<sym> const& math_model_param) {
+        // overwrite the old cached parameters in place, reusing the allocated memory
         math_model_param_ = math_model_param;
+        // the mapping from parameters to entries only depends on the y bus structure, so it is only built once
+        // the same holds for the buses of the elements in the flow calculation
+        if (std::cmp_not_equal(map_param_branch_admittance_.size(), math_topology_->n_branch()) ||
+            std::cmp_not_equal(map_param_shunt_admittance_.size(), math_topology_->n_shunt())) {
+            build_param_admittance_map();
+            build_flow_element_buses();
+        }
         // construct admittance data
-        admittance_ = ComplexTensorVector<sym>(nnz());
+        admittance_.resize(nnz());
 
-        auto const& branch_param = math_model_param_->branch_param;
-        auto const& shunt_param = math_model_param_->shunt_param;
+        auto const& branch_param = math_model_param_.branch_param;
+        auto const& shunt_param = math_model_param_.shunt_param;
         auto const& y_bus_element = y_bus_struct_->y_bus_element;
         auto const& y_bus_entry_indptr = y_bus_struct_->y_bus_entry_indptr;
         // loop for each y bus position
         for (Idx entry = 0; entry != nnz(); ++entry) {
             // start admittance accumulation with zero
             ComplexTensor<sym> entry_admittance{0.0};
-            IdxVector entry_param_shunt;
-            IdxVector entry_param_branch;
             // loop over all entries of this position
             for (Idx element = y_bus_entry_indptr[entry]; element != y_bus_entry_indptr[entry + 1]; ++element) {
                 auto param_idx = y_bus_element[element].idx;
                 if (y_bus_element[element].element_type == YBusElementType::shunt) {
                     entry_admittance += shunt_param[param_idx];
-                    entry_param_shunt.push_back(param_idx);
                 } else {
                     entry_admittance +=
                         branch_param[param_idx].value[static_cast<Idx>(y_bus_element[element].element_type)];
-                    entry_param_branch.push_back(param_idx);
                 }
             }
             // assign
             admittance_[entry] = entry_admittance;
-            map_admittance_param_branch_.push_back(entry_param_branch);
-            map_admittance_param_shunt_.push_back(entry_param_shunt);
+        }
+
+        // element admittances for the flow calculation
+        // NOTE: the shunt admittance is negated for the injection direction of the shunt flow
+        for (Idx branch = 0; branch != math_topology_->n_branch(); ++branch) {
+            branch_admittance_arrays_.set_admittance(branch, branch_param[branch].value);
+        }
+        for (Idx shunt = 0; shunt != math_topology_->n_shunt(); ++shunt) {
+            shunt_admittance_arrays_.set_admittance(shunt, {-shunt_param[shunt]});
         }
 
         parameters_changed(true);
     }
 
-    IdxVector increments_to_entries(auto const& math_model_param_incrmt) {
-        // construct affected entries
+    IdxVector increments_to_entries(auto const& math_model_param_incrmt) const {
+        // construct affected entries, sorted and unique
         IdxVector affected_entries;
 
         auto query_params_in_map = [&affected_entries](auto const& params_to_change, auto const& mapping) {
-            for (size_t i = 0; i < mapping.size(); ++i) {
-                if (std::ranges::any_of(mapping[i], [&](Idx val) {
-                        return std::ranges::find(params_to_change, val) != params_to_change.end();
-                    })) {
-                    affected_entries.push_back(static_cast<int>(i));
-                }
+            for (Idx const param : params_to_change) {
+                affected_entries.insert(affected_entries.end(), mapping[param].cbegin(), mapping[param].cend());
             }
         };
 
-        query_params_in_map(math_model_param_incrmt.branch_param_to_change, map_admittance_param_branch_);
-        query_params_in_map(math_model_param_incrmt.shunt_param_to_change, map_admittance_param_shunt_);
+        query_params_in_map(math_model_param_incrmt.branch_param_to_change, map_param_branch_admittance_);
+        query_params_in_map(math_model_param_incrmt.shunt_param_to_change, map_param_shunt_admittance_);
+        std::ranges::sort(affected_entries);
+        auto const [unique_end, end] = std::ranges::unique(affected_entries);
+        affected_entries.erase(unique_end, end);
         return affected_entries;
     }
 
@@ -395,35 +576,46 @@ template <symmetry_tag sym> class YBus {
      */
     void update_admittance_increment(std::shared_ptr<MathModelParam<sym> const> const& math_model_param,
                                      MathModelParamIncrement const& math_model_param_incrmt) {
-        // swap the old cached parameters
-        math_model_param_ = math_model_param;
+        update_admittance_increment(*math_model_param, math_model_param_incrmt);
+    }
 
-        auto const& y_bus_element = y_bus_struct_->y_bus_element;
-        auto const& y_bus_entry_indptr = y_bus_struct_->y_bus_entry_indptr;
-        auto const& math_param_shunt = math_model_param_->shunt_param;
-        auto const& math_param_branch = math_model_param_->branch_param;
+    /**
+     * @brief Updates the admittance of the y_bus according to what's changed in math_model.
+     *
+     * The cached parameters are overwritten in place, reusing the allocated memory.
+     *
+     * @param math_model_param The constant math_model parameters.
+     * @param math_model_param_incrmt The indices of the changed branch and shunt parameters.
+     */
+    void update_admittance_increment(MathModelParam<sym> const& math_model_param,
+                                     MathModelParamIncrement const& math_model_param_incrmt) {
+        // overwrite the old cached parameters
+        math_model_param_ = math_model_param;
+        update_admittance_entries(math_model_param_incrmt);
+    }
 
-        // process and update affected entries
-        for (auto const affected_entries = increments_to_entries(math_model_param_incrmt);
-             auto const entry : affected_entries) {
-            // start admittance accumulation with zero
-            ComplexTensor<sym> entry_admittance{0.0};
-            // loop over all entries of this position
-            for (Idx element = y_bus_entry_indptr[entry]; element != y_bus_entry_indptr[entry + 1]; ++element) {
-                if (y_bus_element[element].element_type == YBusElementType::shunt) {
-                    // shunt
-                    entry_admittance += math_param_shunt[y_bus_element[element].idx];
-                } else {
-                    // branch
-                    entry_admittance += math_param_branch[y_bus_element[element].idx]
-                                            .value[static_cast<Idx>(y_bus_element[element].element_type)];
-                }
-            }
-            // assign
-            admittance_[entry] = entry_admittance;
+    /**
+     * @brief Updates the changed parameters and the affected admittance entries of the y_bus.
+     *
+     * Only the changed parameters are overwritten; all other cached parameters are kept as they are.
+     *
+     * @param math_model_param_incrmt The indices of the changed branch and shunt parameters.
+     * @param math_model_param_update The new values of the changed parameters, in the same order as the indices.
+     */
+    void update_admittance_increment(MathModelParamIncrement const& math_model_param_incrmt,
+                                     MathModelParamUpdate<sym> const& math_model_param_update) {
+        assert(math_model_param_incrmt.branch_param_to_change.size() == math_model_param_update.branch_param.size());
+        assert(math_model_param_incrmt.shunt_param_to_change.size() == math_model_param_update.shunt_param.size());
+
+        for (size_t i = 0; i != math_model_param_update.branch_param.size(); ++i) {
+            math_model_param_.branch_param[math_model_param_incrmt.branch_param_to_change[i]] =
+                math_model_param_update.branch_param[i];
         }
-
-        parameters_changed(true);
+        for (size_t i = 0; i != math_model_param_update.shunt_param.size(); ++i) {
+            math_model_param_.shunt_param[math_model_param_incrmt.shunt_param_to_change[i]] =
+                math_model_param_update.shunt_param[i];
+        }
+        update_admittance_entries(math_model_param_incrmt);
     }
 
     ComplexValue<sym> calculate_injection(ComplexValueVector<sym> const& u, Idx bus_number) const {
@@ -447,27 +639,15 @@ template <symmetry_tag sym> class YBus {
         requires std::same_as<T, BranchSolverOutput<sym>> || std::same_as<T, BranchShortCircuitSolverOutput<sym>>
     std::vector<T> calculate_branch_flow(ComplexValueVector<sym> const& u) const {
         std::vector<T> branch_flow(math_topology_->branch_bus_idx.size());
-        std::transform(math_topology_->branch_bus_idx.cbegin(), math_topology_->branch_bus_idx.cend(),
-                       math_model_param_->branch_param.cbegin(), branch_flow.begin(),
-                       [&u](BranchIdx branch_idx, BranchCalcParam<sym> const& param) {
-                           auto const [f, t] = branch_idx;
-                           // if one side is disconnected, use zero voltage at that side
-                           ComplexValue<sym> const uf = f != -1 ? u[f] : ComplexValue<sym>{0.0};
-                           ComplexValue<sym> const ut = t != -1 ? u[t] : ComplexValue<sym>{0.0};
-                           T output;
-
-                           // See "Branch Flow Calculation" in "State Estimation Alliander"
-                           output.i_f = dot(param.yff(), uf) + dot(param.yft(), ut);
-                           output.i_t = dot(param.ytf(), uf) + dot(param.ytt(), ut);
-
-                           if constexpr (std::same_as<T, BranchSolverOutput<sym>>) {
-                               // See "Shunt Injection Flow Calculation" in "State Estimation Alliander"
-                               output.s_f = uf * conj(output.i_f);
-                               output.s_t = ut * conj(output.i_t);
-                           }
-
-                           return output;
-                       });
+        // See "Branch Flow Calculation" in "State Estimation Alliander"
+        // if one side is disconnected, use zero voltage at that side
+        if constexpr (std::same_as<T, BranchSolverOutput<sym>>) {
+            // See "Shunt Injection Flow Calculation" in "State Estimation Alliander"
+            branch_admittance_arrays_.template calculate_flow<true>(u, branch_flow, {&T::i_f, &T::i_t},
+                                                                    {&T::s_f, &T::s_t});
+        } else {
+            branch_admittance_arrays_.template calculate_flow<false>(u, branch_flow, {&T::i_f, &T::i_t});
+        }
         return branch_flow;
     }
 
@@ -477,17 +657,13 @@ template <symmetry_tag sym> class YBus {
                  std::same_as<SolverOutputType, ApplianceShortCircuitSolverOutput<sym>>
     std::vector<SolverOutputType> calculate_shunt_flow(ComplexValueVector<sym> const& u) const {
         std::vector<SolverOutputType> shunt_flow(math_topology_->n_shunt());
-        for (auto const [bus, shunts] : enumerated_zip_sequence(math_topology_->shunts_per_bus)) {
-            for (Idx const shunt : shunts) {
-                // See "Branch/Shunt Power Flow" in "State Estimation Alliander"
-                // NOTE: the negative sign for injection direction!
-                shunt_flow[shunt].i = -dot(math_model_param_->shunt_param[shunt], u[bus]);
-
-                if constexpr (std::same_as<SolverOutputType, ApplianceSolverOutput<sym>>) {
-                    // See "Branch/Shunt Power Flow" in "State Estimation Alliander"
-                    shunt_flow[shunt].s = u[bus] * conj(shunt_flow[shunt].i);
-                }
-            }
+        // See "Branch/Shunt Power Flow" in "State Estimation Alliander"
+        // NOTE: the negative sign for injection direction is included in the stored shunt admittance!
+        if constexpr (std::same_as<SolverOutputType, ApplianceSolverOutput<sym>>) {
+            shunt_admittance_arrays_.template calculate_flow<true>(u, shunt_flow, {&SolverOutputType::i},
+                                                                   {&SolverOutputType::s});
+        } else {
+            shunt_admittance_arrays_.template calculate_flow<false>(u, shunt_flow, {&SolverOutputType::i});
         }
         return shunt_flow;
     }
@@ -524,15 +700,19 @@ template <symmetry_tag sym> class YBus {
     std::shared_ptr<MathModelTopology const> math_topology_;
 
     // cache the math parameters
-    std::shared_ptr<MathModelParam<sym> const> math_model_param_;
+    MathModelParam<sym> math_model_param_;
 
     // cache the branch and shunt parameters in sequence_idx_map
     IdxVector branch_param_idx_;
     IdxVector shunt_param_idx_;
 
-    // map index between admittance entries and parameter entries
-    std::vector<IdxVector> map_admittance_param_branch_;
-    std::vector<IdxVector> map_admittance_param_shunt_;
+    // map index between parameter entries and the admittance entries they contribute to
+    std::vector<IdxVector> map_param_branch_admittance_;
+    std::vector<IdxVector> map_param_shunt_admittance_;
+
+    // branch and shunt admittances for the vectorized flow calculation
+    ElementAdmittanceArrays<sym, 2> branch_admittance_arrays_;
+    ElementAdmittanceArrays<sym, 1> shunt_admittance_arrays_;
 
     std::unordered_map<uint64_t, ParamChangedCallback> parameters_changed_callbacks_;
 
@@ -541,6 +721,72 @@ template <symmetry_tag sym> class YBus {
             key_and_callback.second(param_changed);
         });
     }
+
+    void build_param_admittance_map() {
+        auto const& y_bus_element = y_bus_struct_->y_bus_element;
+        auto const& y_bus_entry_indptr = y_bus_struct_->y_bus_entry_indptr;
+        map_param_branch_admittance_.assign(math_topology_->n_branch(), IdxVector{});
+        map_param_shunt_admittance_.assign(math_topology_->n_shunt(), IdxVector{});
+        for (Idx entry = 0; entry != nnz(); ++entry) {
+            for (Idx element = y_bus_entry_indptr[entry]; element != y_bus_entry_indptr[entry + 1]; ++element) {
+                auto param_idx = y_bus_element[element].idx;
+                if (y_bus_element[element].element_type == YBusElementType::shunt) {
+                    map_param_shunt_admittance_[param_idx].push_back(entry);
+                } else {
+                    map_param_branch_admittance_[param_idx].push_back(entry);
+                }
+            }
+        }
+    }
+
+    void build_flow_element_buses() {
+        branch_admittance_arrays_.set_buses(math_topology_->branch_bus_idx);
+        std::vector<std::array<Idx, 1>> shunt_bus(math_topology_->n_shunt());
+        for (auto const& [bus, shunts] : enumerated_zip_sequence(math_topology_->shunts_per_bus)) {
+            for (Idx const shunt : shunts) {
+                shunt_bus[shunt] = {bus};
+            }
+        }
+        shunt_admittance_arrays_.set_buses(shunt_bus);
+    }
+
+    // recalculate the admittance entries affected by the changed parameters
+    void update_admittance_entries(MathModelParamIncrement const& math_model_param_incrmt) {
+        auto const& y_bus_element = y_bus_struct_->y_bus_element;
+        auto const& y_bus_entry_indptr = y_bus_struct_->y_bus_entry_indptr;
+        auto const& math_param_shunt = math_model_param_.shunt_param;
+        auto const& math_param_branch = math_model_param_.branch_param;
+
+        // process and update affected entries
+        for (auto const affected_entries = increments_to_entries(math_model_param_incrmt);
+             auto const entry : affected_entries) {
+            // start admittance accumulation with zero
+            ComplexTensor<sym> entry_admittance{0.0};
+            // loop over all entries of this position
+            for (Idx element = y_bus_entry_indptr[entry]; element != y_bus_entry_indptr[entry + 1]; ++element) {
+                if (y_bus_element[element].element_type == YBusElementType::shunt) {
+                    // shunt
+                    entry_admittance += math_param_shunt[y_bus_element[element].idx];
+                } else {
+                    // branch
+                    entry_admittance += math_param_branch[y_bus_element[element].idx]
+                                            .value[static_cast<Idx>(y_bus_element[element].element_type)];
+                }
+            }
+            // assign
+            admittance_[entry] = entry_admittance;
+        }
+
+        // element admittances for the flow calculation
+        for (Idx const branch : math_model_param_incrmt.branch_param_to_change) {
+            branch_admittance_arrays_.set_admittance(branch, math_param_branch[branch].value);
+        }
+        for (Idx const shunt : math_model_param_incrmt.shunt_param_to_change) {
+            shunt_admittance_arrays_.set_admittance(shunt, {-math_param_shunt[shunt]});
+        }
+
+        parameters_changed(true);
+    }
 };
 
 } // namespace math_solver
@@ -122,6 +122,7 @@ class Topology {
         couple_branch();
         couple_all_appliance();
         couple_sensors();
+        flatten_couplings();
         // create return pair with shared pointer
         std::pair<std::vector<std::shared_ptr<MathModelTopology const>>,
                   std::shared_ptr<TopologicalComponentToMathCoupling const>>
@@ -664,6 +665,16 @@ class Topology {
             comp_coup_.current_sensor,
             [this](Idx i) { return comp_topo_.current_sensor_terminal_type[i] == MeasuredTerminalType::branch_to; });
     }
+
+    void flatten_couplings() {
+        auto const n_math_model = static_cast<Idx>(math_topology_.size());
+        comp_coup_.flat_shunt = flatten_coupling(comp_coup_.shunt, n_math_model);
+        comp_coup_.flat_load_gen = flatten_coupling(comp_coup_.load_gen, n_math_model);
+        comp_coup_.flat_source = flatten_coupling(comp_coup_.source, n_math_model);
+        comp_coup_.flat_voltage_sensor = flatten_coupling(comp_coup_.voltage_sensor, n_math_model);
+        comp_coup_.flat_power_sensor = flatten_coupling(comp_coup_.power_sensor, n_math_model);
+        comp_coup_.flat_current_sensor = flatten_coupling(comp_coup_.current_sensor, n_math_model);
+    }
 };
 
 } // namespace power_grid_model
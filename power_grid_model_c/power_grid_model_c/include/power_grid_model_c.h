@@ -16,6 +16,7 @@
  *     - power_grid_model_c/options.h: functions with setting the calculation options
  *     - power_grid_model_c/serialization.h: functions with serialization functions
  *     - power_grid_model_c/dataset.h: functions with dataset handling functions
+ *     - power_grid_model_c/validation.h: functions with the validation of input datasets
  *     - power_grid_model_c/dataset_definitions.h: external pointer variables to all datasets, components, and
  *       attributes. You have to include this header separately. It is not included by power_grid_model_c.h.
  */
@@ -24,6 +25,7 @@
 #ifndef POWER_GRID_MODEL_C_H
 #define POWER_GRID_MODEL_C_H
 
+#include "power_grid_model_c/arrow_ipc.h"
 #include "power_grid_model_c/basics.h"
 #include "power_grid_model_c/buffer.h"
 #include "power_grid_model_c/dataset.h"
@@ -32,5 +34,6 @@
 #include "power_grid_model_c/model.h"
 #include "power_grid_model_c/options.h"
 #include "power_grid_model_c/serialization.h"
+#include "power_grid_model_c/validation.h"
 
 #endif // POWER_GRID_MODEL_C_H
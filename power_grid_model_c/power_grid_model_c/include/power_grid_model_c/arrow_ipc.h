@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief header file which includes the export and import of components in the Arrow IPC formats
+ *
+ * Every component is a separate Arrow IPC stream or file, with one column per attribute.
+ * The columns have the following Arrow types:
+ *   - int32_t attributes: int32
+ *   - int8_t attributes: int8
+ *   - double attributes: float64
+ *   - double[3] attributes: fixed_size_list<float64>[3]
+ * NaN values of attributes are nulls in the Arrow data, and nulls in the Arrow data are imported as NaN values.
+ * The Arrow libraries are not needed.
+ *
+ */
+
+#pragma once
+#ifndef POWER_GRID_MODEL_C_ARROW_IPC_H
+#define POWER_GRID_MODEL_C_ARROW_IPC_H
+
+#include "basics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create an Arrow IPC exporter for the components of a dataset, the buffers must be set in advance.
+ * @param handle
+ * @param dataset A pointer to an instance of PGM_ConstDataset.
+ * @param arrow_ipc_format The Arrow IPC format of the export. See #PGM_ArrowIpcFormat .
+ * @return A pointer to the new exporter object. Should be freed by PGM_destroy_arrow_exporter().
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_ArrowExporter* PGM_create_arrow_exporter(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                                     PGM_Idx arrow_ipc_format);
+
+/**
+ * @brief Export a component of the dataset as Arrow IPC data.
+ *     A uniform component is written as one record batch.
+ *     A non-uniform component is written as one record batch per scenario.
+ * @param handle
+ * @param exporter A pointer to an existing exporter.
+ * @param component The name of the component.
+ * @param data Output argument: the data pointer of the Arrow IPC data will be written to *data.
+ *     The data is valid until the next export or until the exporter is destroyed.
+ * @param size Output argument: the length of the Arrow IPC data will be written to *size.
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_arrow_exporter_get_component(PGM_Handle* handle, PGM_ArrowExporter* exporter, char const* component,
+                                              char const** data, PGM_Idx* size);
+
+/**
+ * @brief Destroy Arrow IPC exporter.
+ * @param exporter The pointer to the exporter.
+ * @return
+ */
+PGM_API void PGM_destroy_arrow_exporter(PGM_ArrowExporter* exporter);
+
+/**
+ * @brief Create an Arrow IPC importer.
+ *     The importer owns the buffers of the data which cannot be used in place.
+ *     It should therefore outlive the datasets to which components are added.
+ * @param handle
+ * @return A pointer to the new importer object. Should be freed by PGM_destroy_arrow_importer().
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_ArrowImporter* PGM_create_arrow_importer(PGM_Handle* handle);
+
+/**
+ * @brief Add a component from Arrow IPC data, in the streaming or the file format, to a dataset.
+ *     The component is added as a columnar component, with an attribute buffer for every column of the data.
+ *     Columns without a matching attribute are ignored.
+ *     For a batch dataset, each record batch is a scenario if there are as many record batches as scenarios.
+ *     Otherwise, the elements are divided evenly over the scenarios.
+ *     A column which is a single record batch without nulls is used in place, without copying.
+ *     The data should then stay valid and unchanged as long as the dataset is used.
+ * @param handle
+ * @param importer A pointer to an existing importer.
+ * @param dataset A pointer to the PGM_ConstDataset to add the component to.
+ * @param component The name of the component.
+ * @param data The pointer to the Arrow IPC data.
+ * @param size The size of the Arrow IPC data.
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_arrow_importer_add_component(PGM_Handle* handle, PGM_ArrowImporter* importer,
+                                              PGM_ConstDataset* dataset, char const* component, char const* data,
+                                              PGM_Idx size);
+
+/**
+ * @brief Destroy Arrow IPC importer.
+ * @param importer The pointer to the importer.
+ * @return
+ */
+PGM_API void PGM_destroy_arrow_importer(PGM_ArrowImporter* importer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
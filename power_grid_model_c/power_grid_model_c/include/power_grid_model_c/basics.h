@@ -137,6 +137,21 @@ typedef struct PGM_WritableDataset PGM_WritableDataset;
  * @brief Opaque struct for the information of the dataset.
  */
 typedef struct PGM_DatasetInfo PGM_DatasetInfo;
+
+/**
+ * @brief Opaque struct for the Arrow IPC exporter class.
+ */
+typedef struct PGM_ArrowExporter PGM_ArrowExporter;
+
+/**
+ * @brief Opaque struct for the Arrow IPC importer class.
+ */
+typedef struct PGM_ArrowImporter PGM_ArrowImporter;
+
+/**
+ * @brief Opaque struct for the result of a dataset validation.
+ */
+typedef struct PGM_ValidationResult PGM_ValidationResult;
 #endif
 
 // NOLINTEND(modernize-use-using)
@@ -207,6 +222,26 @@ enum PGM_SerializationFormat {
     PGM_msgpack = 1, /**< msgpack serialization format */
 };
 
+/**
+ * @brief Enumeration of Arrow IPC formats.
+ *
+ */
+enum PGM_ArrowIpcFormat {
+    PGM_arrow_stream = 0, /**< Arrow IPC streaming format */
+    PGM_arrow_file = 1,   /**< Arrow IPC file format */
+};
+
+/**
+ * @brief Enumeration of validation error types.
+ *
+ */
+enum PGM_ValidationErrorType {
+    PGM_validation_missing_value = 0,     /**< a required attribute is NaN */
+    PGM_validation_not_unique = 1,        /**< the id is used by more than one element */
+    PGM_validation_invalid_reference = 2, /**< the referenced id does not exist in the referenceable components */
+    PGM_validation_out_of_range = 3,      /**< the value is not within the valid range of the attribute */
+};
+
 /**
  * @brief Enumeration of short circuit voltage scaling.
  *
@@ -246,6 +281,15 @@ enum PGM_ExperimentalFeatures {
     PGM_experimental_features_enabled = 1,  /**< enable experimental features */
 };
 
+/**
+ * @brief Enumeration of thread affinity strategies for batch calculations.
+ *
+ */
+enum PGM_ThreadAffinity {
+    PGM_thread_affinity_none = 0,   /**< leave the placement of the threads to the operating system */
+    PGM_thread_affinity_pinned = 1, /**< pin each worker thread to its own core */
+};
+
 // NOLINTEND(performance-enum-size)
 
 #ifdef __cplusplus
@@ -59,6 +59,26 @@ PGM_API void PGM_destroy_buffer(void* ptr);
 PGM_API void PGM_buffer_set_nan(PGM_Handle* handle, PGM_MetaComponent const* component, void* ptr,
                                 PGM_Idx buffer_offset, PGM_Idx size);
 
+/**
+ * @brief Set all the attributes of a buffer to NaN, using multiple threads for large buffers.
+ *
+ * The result is the same as PGM_buffer_set_nan().
+ * The buffer is divided in contiguous parts which are set in parallel.
+ * Buffers smaller than a few MiB per thread are set in the calling thread.
+ *
+ * @param handle
+ * @param component A component pointer.
+ * @param ptr pointer to buffer, created either by PGM_create_buffer() or your own function.
+ * @param buffer_offset The offset in the buffer where you begin to set nan, in terms of number of elements.
+ * @param size The size of the buffer in terms of number of elements.
+ * @param threading The number of threads, following the threading of a batch calculation:
+ *   - -1: sequential
+ *   - 0: use the number of hardware threads
+ *   - >0: use the specified number of threads
+ */
+PGM_API void PGM_buffer_set_nan_parallel(PGM_Handle* handle, PGM_MetaComponent const* component, void* ptr,
+                                         PGM_Idx buffer_offset, PGM_Idx size, PGM_Idx threading);
+
 /**
  * @brief Set value of a certain attribute from an array to the component buffer.
  *
@@ -101,6 +121,52 @@ PGM_API void PGM_buffer_set_value(PGM_Handle* handle, PGM_MetaAttribute const* a
 PGM_API void PGM_buffer_get_value(PGM_Handle* handle, PGM_MetaAttribute const* attribute, void const* buffer_ptr,
                                   void* dest_ptr, PGM_Idx buffer_offset, PGM_Idx size, PGM_Idx dest_stride);
 
+/**
+ * @brief Set values of multiple attributes from arrays to the component buffer.
+ *
+ * This is the same as calling PGM_buffer_set_value() for every attribute,
+ * but the buffer is filled in blocks of elements, setting all attributes of a block at once.
+ * This is faster when converting many columnar arrays into one row-based buffer.
+ *
+ * @param handle
+ * @param n_attributes The number of attributes.
+ * @param attributes An array of n_attributes attribute pointers, all of the same component.
+ * @param buffer_ptr A pointer to the buffer.
+ * @param src_ptrs An array of n_attributes pointers to the source arrays, in the same order as the attributes.
+ * @param buffer_offset The offset in the buffer where you begin to set value, in terms of number of elements
+ * @param size The size of the buffer in terms of number of elements.
+ * @param src_strides An array of n_attributes strides of the source arrays in bytes,
+ * with the same meaning as src_stride in PGM_buffer_set_value().
+ * You can set it to NULL to use the default stride for all attributes.
+ */
+PGM_API void PGM_buffer_set_columns(PGM_Handle* handle, PGM_Idx n_attributes,
+                                    PGM_MetaAttribute const* const* attributes, void* buffer_ptr,
+                                    void const* const* src_ptrs, PGM_Idx buffer_offset, PGM_Idx size,
+                                    PGM_Idx const* src_strides);
+
+/**
+ * @brief Get values of multiple attributes from the component buffer to arrays.
+ *
+ * This is the same as calling PGM_buffer_get_value() for every attribute,
+ * but the buffer is read in blocks of elements, getting all attributes of a block at once.
+ * This is faster when converting one row-based buffer into many columnar arrays.
+ *
+ * @param handle
+ * @param n_attributes The number of attributes.
+ * @param attributes An array of n_attributes attribute pointers, all of the same component.
+ * @param buffer_ptr A pointer to the buffer.
+ * @param dest_ptrs An array of n_attributes pointers to the destination arrays, in the same order as the attributes.
+ * @param buffer_offset The offset in the buffer where you begin to get value; in terms of number of elements.
+ * @param size The size of the buffer in terms of number of elements.
+ * @param dest_strides An array of n_attributes strides of the destination arrays in bytes,
+ * with the same meaning as dest_stride in PGM_buffer_get_value().
+ * You can set it to NULL to use the default stride for all attributes.
+ */
+PGM_API void PGM_buffer_get_columns(PGM_Handle* handle, PGM_Idx n_attributes,
+                                    PGM_MetaAttribute const* const* attributes, void const* buffer_ptr,
+                                    void* const* dest_ptrs, PGM_Idx buffer_offset, PGM_Idx size,
+                                    PGM_Idx const* dest_strides);
+
 #ifdef __cplusplus
 }
 #endif
@@ -212,6 +212,40 @@ PGM_API void PGM_dataset_const_add_attribute_buffer(PGM_Handle* handle, PGM_Cons
  */
 PGM_API PGM_DatasetInfo const* PGM_dataset_const_get_info(PGM_Handle* handle, PGM_ConstDataset const* dataset);
 
+/**
+ * @brief Get the row based buffer data of a component in an instance of PGM_ConstDataset.
+ * @param handle
+ * @param dataset A pointer to the PGM_ConstDataset.
+ * @param component The name of the component.
+ * @return A void pointer to the row based buffer data, or NULL for columnar data or if errors occur.
+ *     Check the handle for error, e.g. if the component is not in the dataset.
+ */
+PGM_API void const* PGM_dataset_const_get_buffer(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                                 char const* component);
+
+/**
+ * @brief Get the indptr of a component in an instance of PGM_ConstDataset.
+ * @param handle
+ * @param dataset A pointer to the PGM_ConstDataset.
+ * @param component The name of the component.
+ * @return A pointer to the array of indptr of size (batch_size + 1) of a non-uniform component,
+ *     or NULL for a uniform component or if errors occur. Check the handle for error.
+ */
+PGM_API PGM_Idx const* PGM_dataset_const_get_indptr(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                                    char const* component);
+
+/**
+ * @brief Get an attribute buffer of a component in an instance of PGM_ConstDataset.
+ * @param handle
+ * @param dataset A pointer to the PGM_ConstDataset.
+ * @param component The name of the component.
+ * @param attribute The name of the attribute.
+ * @return A void pointer to the attribute buffer data,
+ *     or NULL if the component has no buffer for the attribute or if errors occur. Check the handle for error.
+ */
+PGM_API void const* PGM_dataset_const_get_attribute_buffer(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                                           char const* component, char const* attribute);
+
 /**
  * @brief Get the dataset info of the instance PGM_WritableDataset.
  * @param handle
@@ -309,6 +343,59 @@ PGM_API void PGM_dataset_mutable_add_attribute_buffer(PGM_Handle* handle, PGM_Mu
  */
 PGM_API PGM_DatasetInfo const* PGM_dataset_mutable_get_info(PGM_Handle* handle, PGM_MutableDataset const* dataset);
 
+/**
+ * @brief Get the row based buffer data of a component in an instance of PGM_MutableDataset.
+ * @param handle
+ * @param dataset A pointer to the PGM_MutableDataset.
+ * @param component The name of the component.
+ * @return A void pointer to the row based buffer data, or NULL for columnar data or if errors occur.
+ *     Check the handle for error, e.g. if the component is not in the dataset.
+ */
+PGM_API void* PGM_dataset_mutable_get_buffer(PGM_Handle* handle, PGM_MutableDataset const* dataset,
+                                             char const* component);
+
+/**
+ * @brief Get the indptr of a component in an instance of PGM_MutableDataset.
+ * @param handle
+ * @param dataset A pointer to the PGM_MutableDataset.
+ * @param component The name of the component.
+ * @return A pointer to the array of indptr of size (batch_size + 1) of a non-uniform component,
+ *     or NULL for a uniform component or if errors occur. Check the handle for error.
+ */
+PGM_API PGM_Idx const* PGM_dataset_mutable_get_indptr(PGM_Handle* handle, PGM_MutableDataset const* dataset,
+                                                      char const* component);
+
+/**
+ * @brief Get an attribute buffer of a component in an instance of PGM_MutableDataset.
+ * @param handle
+ * @param dataset A pointer to the PGM_MutableDataset.
+ * @param component The name of the component.
+ * @param attribute The name of the attribute.
+ * @return A void pointer to the attribute buffer data,
+ *     or NULL if the component has no buffer for the attribute or if errors occur. Check the handle for error.
+ */
+PGM_API void* PGM_dataset_mutable_get_attribute_buffer(PGM_Handle* handle, PGM_MutableDataset const* dataset,
+                                                       char const* component, char const* attribute);
+
+/**
+ * @brief Convert the data of a PGM_ConstDataset into the buffers of a PGM_MutableDataset.
+ *
+ * This can be used to convert a dataset between row-based and columnar layouts.
+ * The target dataset should have the same dataset type, batch size and components as the source,
+ * with the same number of elements per scenario (and the same indptr content) per component.
+ * Each component can be row-based or columnar in either dataset, independent of each other.
+ * Attributes in the target which are not present in the source are set to NaN.
+ * The target data can be used as a PGM_ConstDataset via PGM_create_dataset_const_from_mutable().
+ *
+ * @param handle
+ * @param source A pointer to the PGM_ConstDataset to convert from.
+ * @param target A pointer to the PGM_MutableDataset to convert into, with caller-provided buffers.
+ * @param threading The number of threads used for the conversion, in the same way as PGM_set_threading().
+ *     -1: sequential; 0: use the number of hardware threads; > 0: the specified number of threads.
+ */
+PGM_API void PGM_dataset_const_convert(PGM_Handle* handle, PGM_ConstDataset const* source,
+                                       PGM_MutableDataset const* target, PGM_Idx threading);
+
 #ifdef __cplusplus
 }
 #endif
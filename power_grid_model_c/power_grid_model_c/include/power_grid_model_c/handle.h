@@ -88,10 +88,32 @@ PGM_API char const** PGM_batch_errors(PGM_Handle const* handle);
 /**
  * @brief Clear and reset the handle.
  *
+ * The buffer pool set by PGM_set_buffer_pool_size() is kept.
+ *
  * @param handle The pointer to the handle.
  */
 PGM_API void PGM_clear_error(PGM_Handle* handle);
 
+/**
+ * @brief Enable or disable the reuse of buffers created with this handle.
+ *
+ * If enabled, the buffers created by PGM_create_buffer() with this handle are taken from a pool.
+ * When such a buffer is destroyed by PGM_destroy_buffer(), its memory is kept in the pool
+ * and reused by a later PGM_create_buffer() call of a similar size.
+ * This avoids repeated allocations and page faults when buffers are created and destroyed for every calculation.
+ * Buffers of at least 2 MiB are allocated with transparent huge pages where the platform supports it,
+ * regardless of the pool.
+ *
+ * Calling this function again replaces the pool.
+ * The memory cached by the previous pool is freed when all its buffers are destroyed.
+ * The pool is safe to use from multiple threads.
+ *
+ * @param handle The pointer to the handle.
+ * @param max_cached_bytes The maximum number of bytes kept in the pool for reuse.
+ * Zero or negative disables the pool.
+ */
+PGM_API void PGM_set_buffer_pool_size(PGM_Handle* handle, PGM_Idx max_cached_bytes);
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,6 +28,7 @@ extern "C" {
  *   - err_tol: 1e-8
  *   - max_iter: 20
  *   - threading: -1
+ *   - thread_affinity: PGM_thread_affinity_none
  *   - short_circuit_voltage_scaling: PGM_short_circuit_voltage_scaling_maximum
  *   - experimental_features: PGM_experimental_features_disabled
  *
@@ -102,6 +103,20 @@ PGM_API void PGM_set_max_iter(PGM_Handle* handle, PGM_Options* opt, PGM_Idx max_
  */
 PGM_API void PGM_set_threading(PGM_Handle* handle, PGM_Options* opt, PGM_Idx threading);
 
+/**
+ * @brief Specify the placement of the worker threads. Only applicable for parallel batch calculation.
+ *
+ * When the threads are pinned, each worker thread is bound to its own core (round robin over the cores the process is
+ * allowed to run on). The model copy and the solvers of a worker are then allocated on the NUMA node of that core.
+ * The placement is reported in the calculation info. Pinning is not supported on all platforms; on unsupported
+ * platforms, this option has no effect.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param thread_affinity See #PGM_ThreadAffinity .
+ */
+PGM_API void PGM_set_thread_affinity(PGM_Handle* handle, PGM_Options* opt, PGM_Idx thread_affinity);
+
 /**
  * @brief Specify the voltage scaling min/max for short circuit calculations
  *
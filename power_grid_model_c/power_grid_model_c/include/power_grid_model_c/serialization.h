@@ -41,6 +41,20 @@ PGM_API PGM_Deserializer* PGM_create_deserializer_from_null_terminated_string(PG
                                                                               char const* data_string,
                                                                               PGM_Idx serialization_format);
 
+/**
+ * @brief Create a deserializer from a file.
+ *     The file is memory-mapped where the platform supports it.
+ *     Msgpack data is then parsed directly from the mapping, without reading the file into memory first.
+ *     The file should not be modified for the lifetime of the deserializer.
+ * @param handle
+ * @param file_path The null-terminated path of the file.
+ * @param serialization_format The desired data format of the serialization. See #PGM_SerializationFormat .
+ * @return A pointer to the deserializer instance. Should be freed by PGM_destroy_deserializer().
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_Deserializer* PGM_create_deserializer_from_file(PGM_Handle* handle, char const* file_path,
+                                                            PGM_Idx serialization_format);
+
 /**
  * @brief Get the PGM_WritableDataset object from the deserializer.
  * @param handle
@@ -61,6 +75,22 @@ PGM_API PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* handle, PG
  */
 PGM_API void PGM_deserializer_parse_to_buffer(PGM_Handle* handle, PGM_Deserializer* deserializer);
 
+/**
+ * @brief Parse the dataset and write to the user-provided buffers, using multiple threads.
+ *     The result is the same as PGM_deserializer_parse_to_buffer().
+ *     The components and contiguous ranges of scenarios are parsed in parallel.
+ *     The buffers must be set through PGM_writable_dataset_set_buffer().
+ * @param handle
+ * @param deserializer The pointer to the deserializer
+ * @param threading The number of threads, following the threading of a batch calculation:
+ *   - -1: sequential
+ *   - 0: use the number of hardware threads
+ *   - >0: use the specified number of threads
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_deserializer_parse_to_buffer_parallel(PGM_Handle* handle, PGM_Deserializer* deserializer,
+                                                      PGM_Idx threading);
+
 /**
  * @brief Destory deserializer
  * @param deserializer pointer to deserializer
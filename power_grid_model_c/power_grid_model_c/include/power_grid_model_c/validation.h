@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief header file which includes the validation of input datasets
+ *
+ * The validation checks the data of an input dataset before a model is constructed from it.
+ * Every scenario of a batch dataset is validated on its own.
+ * The following is checked:
+ *   - the ids are unique over all components
+ *   - the referenced ids exist, in the components which can be referenced (e.g. the nodes of a line)
+ *   - the attributes which are needed by every calculation type are not NaN
+ *   - the values are within the valid range of the attribute, NaN values are not checked
+ * Every failed check of an attribute of a component is one validation error,
+ *     with the positions of all failing elements in the buffer of the component.
+ *
+ */
+
+#pragma once
+#ifndef POWER_GRID_MODEL_C_VALIDATION_H
+#define POWER_GRID_MODEL_C_VALIDATION_H
+
+#include "basics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Validate an input dataset, the buffers must be set in advance.
+ * @param handle
+ * @param dataset A pointer to an instance of PGM_ConstDataset of the input dataset type.
+ *     The components can be row-based or columnar.
+ * @param threading The threading of the validation.
+ *     < 0 sequential, = 0 use the number of hardware threads, > 0 specified number of threads.
+ * @return A pointer to the validation result. Should be freed by PGM_destroy_validation_result().
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_ValidationResult* PGM_validate_dataset(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                                   PGM_Idx threading);
+
+/**
+ * @brief Get the number of validation errors.
+ * @param handle
+ * @param result A pointer to the validation result.
+ * @return The number of validation errors, zero if the dataset is valid.
+ */
+PGM_API PGM_Idx PGM_validation_result_n_errors(PGM_Handle* handle, PGM_ValidationResult const* result);
+
+/**
+ * @brief Get the type of a validation error.
+ * @param handle
+ * @param result A pointer to the validation result.
+ * @param error_idx The index of the validation error.
+ * @return The type of the validation error. See #PGM_ValidationErrorType .
+ */
+PGM_API PGM_Idx PGM_validation_result_error_type(PGM_Handle* handle, PGM_ValidationResult const* result,
+                                                 PGM_Idx error_idx);
+
+/**
+ * @brief Get the name of the component of a validation error.
+ * @param handle
+ * @param result A pointer to the validation result.
+ * @param error_idx The index of the validation error.
+ * @return A pointer to the null-terminated string of the component name.
+ *     The pointer has the same lifetime as the meta data.
+ */
+PGM_API char const* PGM_validation_result_component_name(PGM_Handle* handle, PGM_ValidationResult const* result,
+                                                         PGM_Idx error_idx);
+
+/**
+ * @brief Get the name of the attribute of a validation error.
+ * @param handle
+ * @param result A pointer to the validation result.
+ * @param error_idx The index of the validation error.
+ * @return A pointer to the null-terminated string of the attribute name.
+ *     The pointer has the same lifetime as the meta data.
+ */
+PGM_API char const* PGM_validation_result_attribute_name(PGM_Handle* handle, PGM_ValidationResult const* result,
+                                                         PGM_Idx error_idx);
+
+/**
+ * @brief Get the number of failing elements of a validation error.
+ * @param handle
+ * @param result A pointer to the validation result.
+ * @param error_idx The index of the validation error.
+ * @return The number of failing elements.
+ */
+PGM_API PGM_Idx PGM_validation_result_n_elements(PGM_Handle* handle, PGM_ValidationResult const* result,
+                                                 PGM_Idx error_idx);
+
+/**
+ * @brief Get the failing elements of a validation error.
+ * @param handle
+ * @param result A pointer to the validation result.
+ * @param error_idx The index of the validation error.
+ * @return A pointer to the sorted positions of the failing elements in the buffer of the component,
+ *     counted over all scenarios. The array has PGM_validation_result_n_elements() entries.
+ *     The pointer is valid until the validation result is destroyed.
+ */
+PGM_API PGM_Idx const* PGM_validation_result_elements(PGM_Handle* handle, PGM_ValidationResult const* result,
+                                                      PGM_Idx error_idx);
+
+/**
+ * @brief Destroy a validation result.
+ * @param result The pointer to the validation result.
+ * @return
+ */
+PGM_API void PGM_destroy_validation_result(PGM_ValidationResult* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
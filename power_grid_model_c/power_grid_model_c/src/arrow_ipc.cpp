@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#define PGM_DLL_EXPORTS
+#include "forward_declarations.hpp"
+
+#include "handle.hpp"
+#include "power_grid_model_c/arrow_ipc.h"
+#include "power_grid_model_c/basics.h"
+#include "power_grid_model_c/handle.h"
+
+#include <power_grid_model/auxiliary/serialization/arrow_ipc.hpp>
+
+using namespace power_grid_model::meta_data;
+
+PGM_ArrowExporter* PGM_create_arrow_exporter(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                             PGM_Idx arrow_ipc_format) {
+    return call_with_catch(
+        handle,
+        [dataset, arrow_ipc_format] {
+            return new PGM_ArrowExporter{*dataset, static_cast<power_grid_model::ArrowIpcFormat>(arrow_ipc_format)};
+        },
+        PGM_serialization_error);
+}
+
+void PGM_arrow_exporter_get_component(PGM_Handle* handle, PGM_ArrowExporter* exporter, char const* component,
+                                      char const** data, PGM_Idx* size) {
+    call_with_catch(
+        handle,
+        [exporter, component, data, size] {
+            auto const buffer_data = exporter->get_component(component);
+            *data = buffer_data.data();
+            *size = static_cast<PGM_Idx>(buffer_data.size());
+        },
+        PGM_serialization_error);
+}
+
+void PGM_destroy_arrow_exporter(PGM_ArrowExporter* exporter) { delete exporter; }
+
+PGM_ArrowImporter* PGM_create_arrow_importer(PGM_Handle* handle) {
+    return call_with_catch(handle, [] { return new PGM_ArrowImporter{}; }, PGM_serialization_error);
+}
+
+void PGM_arrow_importer_add_component(PGM_Handle* handle, PGM_ArrowImporter* importer, PGM_ConstDataset* dataset,
+                                      char const* component, char const* data, PGM_Idx size) {
+    call_with_catch(
+        handle,
+        [importer, dataset, component, data, size] {
+            importer->add_component(*dataset, component, {data, static_cast<size_t>(size)});
+        },
+        PGM_serialization_error);
+}
+
+void PGM_destroy_arrow_importer(PGM_ArrowImporter* importer) { delete importer; }
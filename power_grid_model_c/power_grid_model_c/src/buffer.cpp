@@ -7,9 +7,12 @@
 
 #include "power_grid_model_c/buffer.h"
 
+#include "handle.hpp"
+
+#include <power_grid_model/auxiliary/buffer_pool.hpp>
 #include <power_grid_model/auxiliary/meta_data.hpp>
 
-#include <cstdlib>
+#include <algorithm>
 
 namespace {
 using namespace power_grid_model;
@@ -19,31 +22,27 @@ using meta_data::RawDataPtr;
 } // namespace
 
 // buffer control
-RawDataPtr PGM_create_buffer(PGM_Handle* /* handle */, PGM_MetaComponent const* component, PGM_Idx size) {
+RawDataPtr PGM_create_buffer(PGM_Handle* handle, PGM_MetaComponent const* component, PGM_Idx size) {
     // alignment should be maximum of alignment of the component and alignment of void*
     size_t const alignment = std::max(component->alignment, sizeof(void*));
-    // total bytes should be multiple of alignment
-    size_t const requested_bytes = component->size * size;
-    size_t const rounded_bytes = ((requested_bytes + alignment - 1) / alignment) * alignment;
-#ifdef _WIN32
-    return _aligned_malloc(rounded_bytes, alignment);
-#else
-    return std::aligned_alloc(alignment, rounded_bytes);
-#endif
-}
-void PGM_destroy_buffer(RawDataPtr ptr) {
-#ifdef _WIN32
-    _aligned_free(ptr);
-#else
-    std::free(ptr);
-#endif
+    return meta_data::create_buffer(component->size * size, alignment,
+                                    handle != nullptr ? handle->buffer_pool : nullptr);
 }
+void PGM_destroy_buffer(RawDataPtr ptr) { meta_data::destroy_buffer(ptr); }
 void PGM_buffer_set_nan(PGM_Handle* /* handle */, PGM_MetaComponent const* component, void* ptr, PGM_Idx buffer_offset,
                         PGM_Idx size) {
     component->set_nan(ptr, buffer_offset, size);
 }
+void PGM_buffer_set_nan_parallel(PGM_Handle* /* handle */, PGM_MetaComponent const* component, void* ptr,
+                                 PGM_Idx buffer_offset, PGM_Idx size, PGM_Idx threading) {
+    component->set_nan_parallel(ptr, buffer_offset, size, threading);
+}
 
 namespace {
+// number of elements per pass when copying multiple attributes
+// the rows of the buffer in one pass stay in cache while all attributes are copied
+constexpr Idx columns_block_size = 256;
+
 // template for get and set attribute
 template <bool is_get, class BufferPtr, class ValuePtr>
 void buffer_get_set_value(PGM_MetaAttribute const* attribute, BufferPtr buffer_ptr, ValuePtr value_ptr,
@@ -52,13 +51,23 @@ void buffer_get_set_value(PGM_MetaAttribute const* attribute, BufferPtr buffer_p
     if (stride < 0) {
         stride = static_cast<PGM_Idx>(attribute->size);
     }
-    for (Idx i = buffer_offset; i != size + buffer_offset; ++i) {
-        ValuePtr const shifted_value_ptr =
-            reinterpret_cast<std::conditional_t<is_get, char*, char const*>>(value_ptr) + stride * i;
-        if constexpr (is_get) {
-            attribute->get_value(buffer_ptr, shifted_value_ptr, i);
-        } else {
-            attribute->set_value(buffer_ptr, shifted_value_ptr, i);
+    if constexpr (is_get) {
+        attribute->get_values(buffer_ptr, value_ptr, buffer_offset, size, stride);
+    } else {
+        attribute->set_values(buffer_ptr, value_ptr, buffer_offset, size, stride);
+    }
+}
+
+// template for get and set multiple attributes, block by block
+template <bool is_get, class BufferPtr, class ValuePtr>
+void buffer_get_set_columns(PGM_Idx n_attributes, PGM_MetaAttribute const* const* attributes,
+                            BufferPtr buffer_ptr, ValuePtr const* value_ptrs, PGM_Idx buffer_offset, PGM_Idx size,
+                            PGM_Idx const* strides) {
+    for (Idx block_begin = buffer_offset; block_begin < buffer_offset + size; block_begin += columns_block_size) {
+        Idx const block_size = std::min(columns_block_size, buffer_offset + size - block_begin);
+        for (Idx attribute_idx = 0; attribute_idx != n_attributes; ++attribute_idx) {
+            buffer_get_set_value<is_get>(attributes[attribute_idx], buffer_ptr, value_ptrs[attribute_idx],
+                                         block_begin, block_size, strides == nullptr ? -1 : strides[attribute_idx]);
         }
     }
 }
@@ -71,3 +80,15 @@ void PGM_buffer_get_value(PGM_Handle* /* handle */, PGM_MetaAttribute const* att
                           RawDataPtr dest_ptr, PGM_Idx buffer_offset, PGM_Idx size, PGM_Idx dest_stride) {
     buffer_get_set_value<true>(attribute, buffer_ptr, dest_ptr, buffer_offset, size, dest_stride);
 }
+void PGM_buffer_set_columns(PGM_Handle* /* handle */, PGM_Idx n_attributes,
+                            PGM_MetaAttribute const* const* attributes, RawDataPtr buffer_ptr,
+                            RawDataConstPtr const* src_ptrs, PGM_Idx buffer_offset, PGM_Idx size,
+                            PGM_Idx const* src_strides) {
+    buffer_get_set_columns<false>(n_attributes, attributes, buffer_ptr, src_ptrs, buffer_offset, size, src_strides);
+}
+void PGM_buffer_get_columns(PGM_Handle* /* handle */, PGM_Idx n_attributes,
+                            PGM_MetaAttribute const* const* attributes, RawDataConstPtr buffer_ptr,
+                            RawDataPtr const* dest_ptrs, PGM_Idx buffer_offset, PGM_Idx size,
+                            PGM_Idx const* dest_strides) {
+    buffer_get_set_columns<true>(n_attributes, attributes, buffer_ptr, dest_ptrs, buffer_offset, size, dest_strides);
+}
@@ -10,11 +10,33 @@
 #include "power_grid_model_c/dataset.h"
 
 #include <power_grid_model/auxiliary/dataset.hpp>
+#include <power_grid_model/auxiliary/dataset_conversion.hpp>
 #include <power_grid_model/auxiliary/meta_data.hpp>
 
+#include <algorithm>
+#include <string_view>
+
 using namespace power_grid_model;
 using namespace power_grid_model::meta_data;
 
+namespace {
+template <dataset_type_tag dataset_type>
+auto get_indptr(Dataset<dataset_type> const& dataset, char const* component) -> PGM_Idx const* {
+    auto const& buffer = dataset.get_buffer(component);
+    return buffer.indptr.empty() ? nullptr : buffer.indptr.data();
+}
+
+template <dataset_type_tag dataset_type>
+auto get_attribute_buffer(Dataset<dataset_type> const& dataset, char const* component, char const* attribute) ->
+    typename Dataset<dataset_type>::Data* {
+    auto const& attributes = dataset.get_buffer(component).attributes;
+    auto const found = std::ranges::find_if(attributes, [attribute](auto const& attribute_buffer) {
+        return std::string_view{attribute_buffer.meta_attribute->name} == attribute;
+    });
+    return found == attributes.cend() ? nullptr : found->data;
+}
+} // namespace
+
 // dataset info
 
 char const* PGM_dataset_info_name(PGM_Handle* /*unused*/, PGM_DatasetInfo const* info) { return info->dataset->name; }
@@ -105,6 +127,24 @@ PGM_DatasetInfo const* PGM_dataset_const_get_info(PGM_Handle* /*unused*/, PGM_Co
     return &dataset->get_description();
 }
 
+void const* PGM_dataset_const_get_buffer(PGM_Handle* handle, PGM_ConstDataset const* dataset, char const* component) {
+    return call_with_catch(
+        handle, [dataset, component]() { return dataset->get_buffer(component).data; }, PGM_regular_error);
+}
+
+PGM_Idx const* PGM_dataset_const_get_indptr(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                            char const* component) {
+    return call_with_catch(
+        handle, [dataset, component]() { return get_indptr(*dataset, component); }, PGM_regular_error);
+}
+
+void const* PGM_dataset_const_get_attribute_buffer(PGM_Handle* handle, PGM_ConstDataset const* dataset,
+                                                   char const* component, char const* attribute) {
+    return call_with_catch(
+        handle, [dataset, component, attribute]() { return get_attribute_buffer(*dataset, component, attribute); },
+        PGM_regular_error);
+}
+
 // writable dataset
 
 PGM_DatasetInfo const* PGM_dataset_writable_get_info(PGM_Handle* /*unused*/, PGM_WritableDataset const* dataset) {
@@ -160,3 +200,27 @@ void PGM_dataset_mutable_add_attribute_buffer(PGM_Handle* handle, PGM_MutableDat
 PGM_DatasetInfo const* PGM_dataset_mutable_get_info(PGM_Handle* /*unused*/, PGM_MutableDataset const* dataset) {
     return &dataset->get_description();
 }
+
+void* PGM_dataset_mutable_get_buffer(PGM_Handle* handle, PGM_MutableDataset const* dataset, char const* component) {
+    return call_with_catch(
+        handle, [dataset, component]() { return dataset->get_buffer(component).data; }, PGM_regular_error);
+}
+
+PGM_Idx const* PGM_dataset_mutable_get_indptr(PGM_Handle* handle, PGM_MutableDataset const* dataset,
+                                              char const* component) {
+    return call_with_catch(
+        handle, [dataset, component]() { return get_indptr(*dataset, component); }, PGM_regular_error);
+}
+
+void* PGM_dataset_mutable_get_attribute_buffer(PGM_Handle* handle, PGM_MutableDataset const* dataset,
+                                               char const* component, char const* attribute) {
+    return call_with_catch(
+        handle, [dataset, component, attribute]() { return get_attribute_buffer(*dataset, component, attribute); },
+        PGM_regular_error);
+}
+
+void PGM_dataset_const_convert(PGM_Handle* handle, PGM_ConstDataset const* source, PGM_MutableDataset const* target,
+                               PGM_Idx threading) {
+    call_with_catch(
+        handle, [source, target, threading]() { convert_dataset(*source, *target, threading); }, PGM_regular_error);
+}
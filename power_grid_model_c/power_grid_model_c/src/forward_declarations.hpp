@@ -20,6 +20,9 @@ struct MetaComponent;
 struct MetaDataset;
 class Serializer;
 class Deserializer;
+class ArrowExporter;
+class ArrowImporter;
+struct ValidationResult;
 
 template <dataset_type_tag dataset_type> class Dataset;
 
@@ -32,6 +35,9 @@ using PGM_MetaComponent = power_grid_model::meta_data::MetaComponent;
 using PGM_MetaDataset = power_grid_model::meta_data::MetaDataset;
 using PGM_Serializer = power_grid_model::meta_data::Serializer;
 using PGM_Deserializer = power_grid_model::meta_data::Deserializer;
+using PGM_ArrowExporter = power_grid_model::meta_data::ArrowExporter;
+using PGM_ArrowImporter = power_grid_model::meta_data::ArrowImporter;
+using PGM_ValidationResult = power_grid_model::meta_data::ValidationResult;
 using PGM_ConstDataset = power_grid_model::meta_data::Dataset<power_grid_model::const_dataset_t>;
 using PGM_MutableDataset = power_grid_model::meta_data::Dataset<power_grid_model::mutable_dataset_t>;
 using PGM_WritableDataset = power_grid_model::meta_data::Dataset<power_grid_model::writable_dataset_t>;
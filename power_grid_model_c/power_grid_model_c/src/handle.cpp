@@ -30,4 +30,17 @@ char const** PGM_batch_errors(PGM_Handle const* handle) {
                            [](auto const& x) { return x.c_str(); });
     return handle->batch_errs_c_str.data();
 }
-void PGM_clear_error(PGM_Handle* handle) { *handle = PGM_Handle{}; }
+void PGM_clear_error(PGM_Handle* handle) {
+    auto buffer_pool = std::move(handle->buffer_pool);
+    *handle = PGM_Handle{};
+    handle->buffer_pool = std::move(buffer_pool);
+}
+
+// buffer pool
+void PGM_set_buffer_pool_size(PGM_Handle* handle, PGM_Idx max_cached_bytes) {
+    if (max_cached_bytes > 0) {
+        handle->buffer_pool = std::make_shared<meta_data::BufferPool>(static_cast<size_t>(max_cached_bytes));
+    } else {
+        handle->buffer_pool.reset();
+    }
+}
@@ -12,6 +12,7 @@
 
 #include "power_grid_model_c/handle.h"
 
+#include <power_grid_model/auxiliary/buffer_pool.hpp>
 #include <power_grid_model/batch_parameter.hpp>
 #include <power_grid_model/common/common.hpp>
 
@@ -25,6 +26,8 @@ struct PGM_Handle {
     std::vector<std::string> batch_errs;
     mutable std::vector<char const*> batch_errs_c_str;
     [[no_unique_address]] power_grid_model::BatchParameter batch_parameter;
+    // pool of buffers created with this handle, kept when the error is cleared
+    std::shared_ptr<power_grid_model::meta_data::BufferPool> buffer_pool;
 };
 
 template <class Exception = std::exception, class Functor>
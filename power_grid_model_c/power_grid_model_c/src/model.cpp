@@ -20,8 +20,15 @@ using namespace power_grid_model;
 } // namespace
 
 // aliases main class
-struct PGM_PowerGridModel : public MainModel {
-    using MainModel::MainModel;
+// the power flow build of the library is restricted to the reduced component set
+#ifdef PGM_POWER_FLOW_COMPONENTS_ONLY
+using CModel = BasicMainModel<PowerFlowComponents>;
+#else
+using CModel = MainModel;
+#endif
+
+struct PGM_PowerGridModel : public CModel {
+    using CModel::CModel;
 };
 
 // create model
@@ -56,7 +63,7 @@ void PGM_get_indexer(PGM_Handle* handle, PGM_PowerGridModel const* model, char c
 }
 
 namespace {
-void check_no_experimental_features_used(MainModel const& model, MainModel::Options const& opt) {
+void check_no_experimental_features_used(CModel const& model, CModel::Options const& opt) {
     // optionally add experimental feature checks here
     using namespace std::string_literals;
 
@@ -129,16 +136,30 @@ constexpr auto get_short_circuit_voltage_scaling(PGM_Options const& opt) {
     return static_cast<ShortCircuitVoltageScaling>(opt.short_circuit_voltage_scaling);
 }
 
+constexpr auto get_thread_affinity(PGM_Options const& opt) {
+    using enum ThreadAffinity;
+
+    switch (opt.thread_affinity) {
+    case PGM_thread_affinity_none:
+        return none;
+    case PGM_thread_affinity_pinned:
+        return pinned;
+    default:
+        throw MissingCaseForEnumError{"get_thread_affinity", opt.thread_affinity};
+    }
+}
+
 constexpr auto extract_calculation_options(PGM_Options const& opt) {
-    return MainModel::Options{.calculation_type = get_calculation_type(opt),
-                              .calculation_symmetry = get_calculation_symmetry(opt),
-                              .calculation_method = get_calculation_method(opt),
-                              .optimizer_type = get_optimizer_type(opt),
-                              .optimizer_strategy = get_optimizer_strategy(opt),
-                              .err_tol = opt.err_tol,
-                              .max_iter = opt.max_iter,
-                              .threading = opt.threading,
-                              .short_circuit_voltage_scaling = get_short_circuit_voltage_scaling(opt)};
+    return CModel::Options{.calculation_type = get_calculation_type(opt),
+                           .calculation_symmetry = get_calculation_symmetry(opt),
+                           .calculation_method = get_calculation_method(opt),
+                           .optimizer_type = get_optimizer_type(opt),
+                           .optimizer_strategy = get_optimizer_strategy(opt),
+                           .err_tol = opt.err_tol,
+                           .max_iter = opt.max_iter,
+                           .threading = opt.threading,
+                           .thread_affinity = get_thread_affinity(opt),
+                           .short_circuit_voltage_scaling = get_short_circuit_voltage_scaling(opt)};
 }
 } // namespace
 
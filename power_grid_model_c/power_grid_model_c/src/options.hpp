@@ -23,6 +23,7 @@ struct PGM_Options {
     double err_tol{1e-8};
     Idx max_iter{20};
     Idx threading{-1};
+    Idx thread_affinity{PGM_thread_affinity_none};
     Idx short_circuit_voltage_scaling{PGM_short_circuit_voltage_scaling_maximum};
     Idx tap_changing_strategy{PGM_tap_changing_strategy_disabled};
     Idx experimental_features{PGM_experimental_features_disabled};
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#define PGM_DLL_EXPORTS
+#include "forward_declarations.hpp"
+
+#include "handle.hpp"
+#include "power_grid_model_c/basics.h"
+#include "power_grid_model_c/handle.h"
+#include "power_grid_model_c/validation.h"
+
+#include <power_grid_model/auxiliary/dataset_validation.hpp>
+
+using namespace power_grid_model::meta_data;
+
+PGM_ValidationResult* PGM_validate_dataset(PGM_Handle* handle, PGM_ConstDataset const* dataset, PGM_Idx threading) {
+    return call_with_catch(
+        handle, [dataset, threading] { return new PGM_ValidationResult{validate_dataset(*dataset, threading)}; },
+        PGM_regular_error);
+}
+
+PGM_Idx PGM_validation_result_n_errors(PGM_Handle* /*unused*/, PGM_ValidationResult const* result) {
+    return static_cast<PGM_Idx>(result->errors.size());
+}
+
+PGM_Idx PGM_validation_result_error_type(PGM_Handle* /*unused*/, PGM_ValidationResult const* result,
+                                         PGM_Idx error_idx) {
+    return static_cast<PGM_Idx>(result->errors[error_idx].error_type);
+}
+
+char const* PGM_validation_result_component_name(PGM_Handle* /*unused*/, PGM_ValidationResult const* result,
+                                                 PGM_Idx error_idx) {
+    return result->errors[error_idx].component->name;
+}
+
+char const* PGM_validation_result_attribute_name(PGM_Handle* /*unused*/, PGM_ValidationResult const* result,
+                                                 PGM_Idx error_idx) {
+    return result->errors[error_idx].attribute->name;
+}
+
+PGM_Idx PGM_validation_result_n_elements(PGM_Handle* /*unused*/, PGM_ValidationResult const* result,
+                                         PGM_Idx error_idx) {
+    return static_cast<PGM_Idx>(result->errors[error_idx].elements.size());
+}
+
+PGM_Idx const* PGM_validation_result_elements(PGM_Handle* /*unused*/, PGM_ValidationResult const* result,
+                                              PGM_Idx error_idx) {
+    return result->errors[error_idx].elements.data();
+}
+
+void PGM_destroy_validation_result(PGM_ValidationResult* result) { delete result; }
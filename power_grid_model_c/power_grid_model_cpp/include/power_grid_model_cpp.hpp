@@ -6,6 +6,8 @@
 #ifndef POWER_GRID_MODEL_CPP_HPP
 #define POWER_GRID_MODEL_CPP_HPP
 
+#include "power_grid_model_cpp/arrow_ipc.hpp"
+#include "power_grid_model_cpp/attribute_view.hpp"
 #include "power_grid_model_cpp/basics.hpp"
 #include "power_grid_model_cpp/buffer.hpp"
 #include "power_grid_model_cpp/dataset.hpp"
@@ -15,5 +17,6 @@
 #include "power_grid_model_cpp/options.hpp"
 #include "power_grid_model_cpp/serialization.hpp"
 #include "power_grid_model_cpp/utils.hpp"
+#include "power_grid_model_cpp/validation.hpp"
 
 #endif // POWER_GRID_MODEL_CPP_HPP
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#ifndef POWER_GRID_MODEL_CPP_ARROW_IPC_HPP
+#define POWER_GRID_MODEL_CPP_ARROW_IPC_HPP
+
+#include "basics.hpp"
+#include "dataset.hpp"
+#include "handle.hpp"
+
+#include "power_grid_model_c/arrow_ipc.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace power_grid_model_cpp {
+class ArrowExporter {
+  public:
+    ArrowExporter(DatasetConst const& dataset, Idx arrow_ipc_format)
+        : exporter_{handle_.call_with(PGM_create_arrow_exporter, dataset.get(), arrow_ipc_format)} {}
+
+    RawArrowExporter* get() { return exporter_.get(); }
+    RawArrowExporter const* get() const { return exporter_.get(); }
+
+    // the data is valid until the next export
+    std::string_view get_component(std::string const& component) {
+        char const* temp_data{};
+        Idx buffer_size{};
+        handle_.call_with(PGM_arrow_exporter_get_component, get(), component.c_str(), &temp_data, &buffer_size);
+        return std::string_view{temp_data, static_cast<size_t>(buffer_size)};
+    }
+
+    void get_component(std::string const& component, std::vector<char>& data) {
+        auto const temp_data = get_component(component);
+        data.assign(temp_data.begin(), temp_data.end());
+    }
+
+  private:
+    Handle handle_{};
+    detail::UniquePtr<RawArrowExporter, &PGM_destroy_arrow_exporter> exporter_;
+};
+
+// the importer should outlive the datasets to which components are added
+class ArrowImporter {
+  public:
+    ArrowImporter() : importer_{handle_.call_with(PGM_create_arrow_importer)} {}
+
+    RawArrowImporter* get() { return importer_.get(); }
+    RawArrowImporter const* get() const { return importer_.get(); }
+
+    // columns without nulls are used in place, so the data should stay valid as long as the dataset is used
+    void add_component(DatasetConst& dataset, std::string const& component, std::string_view data) {
+        handle_.call_with(PGM_arrow_importer_add_component, get(), dataset.get(), component.c_str(), data.data(),
+                          static_cast<Idx>(data.size()));
+    }
+
+    void add_component(DatasetConst& dataset, std::string const& component, std::vector<char> const& data) {
+        add_component(dataset, component, std::string_view{data.data(), data.size()});
+    }
+
+  private:
+    Handle handle_{};
+    detail::UniquePtr<RawArrowImporter, &PGM_destroy_arrow_importer> importer_;
+};
+} // namespace power_grid_model_cpp
+
+#endif // POWER_GRID_MODEL_CPP_ARROW_IPC_HPP
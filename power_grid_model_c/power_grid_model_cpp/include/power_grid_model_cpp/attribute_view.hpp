@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#ifndef POWER_GRID_MODEL_CPP_ATTRIBUTE_VIEW_HPP
+#define POWER_GRID_MODEL_CPP_ATTRIBUTE_VIEW_HPP
+
+#include "basics.hpp"
+#include "buffer.hpp"
+#include "dataset.hpp"
+#include "handle.hpp"
+#include "meta_data.hpp"
+#include "utils.hpp"
+
+#include <cassert>
+#include <compare>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace power_grid_model_cpp {
+class AttributeTypeMismatch : public PowerGridError {
+  public:
+    explicit AttributeTypeMismatch(MetaAttribute const* attribute)
+        : PowerGridError{[&]() {
+              using namespace std::string_literals;
+              return "Type mismatch for attribute "s + MetaData::attribute_name(attribute);
+          }()} {}
+};
+
+class AttributeBufferNotFound : public PowerGridError {
+  public:
+    AttributeBufferNotFound(std::string const& component, std::string const& attribute)
+        : PowerGridError{[&]() {
+              using namespace std::string_literals;
+              return "No buffer for attribute "s + attribute + " of component "s + component;
+          }()} {}
+};
+
+// typed view on the values of one attribute in a row-based or columnar buffer
+// the value of element i is at (char*)data + i * stride
+//    for a row-based buffer, data points to the attribute of the first element and the stride is the component size
+//    for a columnar buffer, the stride is the size of the value
+// the offsets are looked up once when the view is created, element access is a direct load or store
+// T can be const qualified for a read-only view
+template <typename T> class AttributeView {
+  public:
+    using value_type = std::remove_const_t<T>;
+    using BytePtr = std::conditional_t<std::is_const_v<T>, char const*, char*>;
+    using RawPtr = std::conditional_t<std::is_const_v<T>, RawDataConstPtr, RawDataPtr>;
+
+    class iterator {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = std::remove_const_t<T>;
+        using difference_type = Idx;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+        iterator(BytePtr ptr, Idx stride) : ptr_{ptr}, stride_{stride} {}
+
+        T& operator*() const { return *reinterpret_cast<T*>(ptr_); }
+        T* operator->() const { return reinterpret_cast<T*>(ptr_); }
+        T& operator[](Idx n) const { return *reinterpret_cast<T*>(ptr_ + n * stride_); }
+
+        iterator& operator++() {
+            ptr_ += stride_;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator const result{*this};
+            ++(*this);
+            return result;
+        }
+        iterator& operator--() {
+            ptr_ -= stride_;
+            return *this;
+        }
+        iterator operator--(int) {
+            iterator const result{*this};
+            --(*this);
+            return result;
+        }
+        iterator& operator+=(Idx n) {
+            ptr_ += n * stride_;
+            return *this;
+        }
+        iterator& operator-=(Idx n) {
+            ptr_ -= n * stride_;
+            return *this;
+        }
+        friend iterator operator+(iterator it, Idx n) { return it += n; }
+        friend iterator operator+(Idx n, iterator it) { return it += n; }
+        friend iterator operator-(iterator it, Idx n) { return it -= n; }
+        friend Idx operator-(iterator const& x, iterator const& y) {
+            assert(x.stride_ == y.stride_);
+            return (x.ptr_ - y.ptr_) / x.stride_;
+        }
+        friend bool operator==(iterator const& x, iterator const& y) { return x.ptr_ == y.ptr_; }
+        friend std::strong_ordering operator<=>(iterator const& x, iterator const& y) {
+            return std::compare_three_way{}(x.ptr_, y.ptr_);
+        }
+
+      private:
+        BytePtr ptr_{nullptr};
+        Idx stride_{sizeof(T)};
+    };
+
+    AttributeView() = default;
+    // contiguous values, e.g. a columnar attribute buffer
+    AttributeView(T* data, Idx size) : AttributeView{data, size, static_cast<Idx>(sizeof(T))} {}
+    // strided values, the stride is in bytes and should be positive
+    AttributeView(RawPtr data, Idx size, Idx stride)
+        : data_{reinterpret_cast<BytePtr>(data)}, size_{size}, stride_{stride} {
+        assert(stride_ > 0);
+    }
+    // a mutable view can be used as a read-only view
+    template <typename U>
+        requires(std::is_const_v<T> && std::same_as<U, value_type>)
+    AttributeView(AttributeView<U> const& other) : AttributeView{other.data(), other.size(), other.stride()} {}
+
+    RawPtr data() const { return data_; }
+    Idx size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    Idx stride() const { return stride_; }
+    bool is_contiguous() const { return stride_ == static_cast<Idx>(sizeof(T)); }
+
+    T& operator[](Idx idx) const {
+        assert(idx >= 0 && idx < size_);
+        return *reinterpret_cast<T*>(data_ + idx * stride_);
+    }
+
+    iterator begin() const { return iterator{data_, stride_}; }
+    iterator end() const { return iterator{data_ + size_ * stride_, stride_}; }
+
+    // the elements [offset, offset + size) of the view
+    AttributeView subview(Idx offset, Idx size) const {
+        assert(offset >= 0 && size >= 0 && offset + size <= size_);
+        return AttributeView{data_ + offset * stride_, size, stride_};
+    }
+
+    // only for contiguous values
+    std::span<T> as_span() const {
+        assert(is_contiguous());
+        return {reinterpret_cast<T*>(data_), static_cast<size_t>(size_)};
+    }
+
+  private:
+    BytePtr data_{nullptr};
+    Idx size_{0};
+    Idx stride_{sizeof(T)};
+};
+
+static_assert(std::random_access_iterator<AttributeView<double>::iterator>);
+static_assert(std::random_access_iterator<AttributeView<double const>::iterator>);
+
+namespace detail {
+template <typename T> void check_attribute_type(MetaAttribute const* attribute) {
+    if (MetaData::attribute_ctype(attribute) != pgm_ctype_v<T>) {
+        throw AttributeTypeMismatch{attribute};
+    }
+}
+} // namespace detail
+
+// view on an attribute of size elements of row-based data of the component
+template <typename T>
+AttributeView<T> attribute_view(typename AttributeView<T>::RawPtr data, MetaComponent const* component,
+                                MetaAttribute const* attribute, Idx size) {
+    detail::check_attribute_type<T>(attribute);
+    using BytePtr = typename AttributeView<T>::BytePtr;
+    return AttributeView<T>{reinterpret_cast<BytePtr>(data) + MetaData::attribute_offset(attribute), size,
+                            static_cast<Idx>(MetaData::component_size(component))};
+}
+
+// view on an attribute of all elements of a row-based buffer
+template <typename T> AttributeView<T> attribute_view(Buffer& buffer, MetaAttribute const* attribute) {
+    return attribute_view<T>(buffer.get(), buffer.component(), attribute, buffer.size());
+}
+template <typename T>
+    requires std::is_const_v<T>
+AttributeView<T> attribute_view(Buffer const& buffer, MetaAttribute const* attribute) {
+    return attribute_view<T>(buffer.get(), buffer.component(), attribute, buffer.size());
+}
+
+// view on a columnar attribute buffer of size elements
+template <typename T>
+AttributeView<T> attribute_view(typename AttributeView<T>::RawPtr data, MetaAttribute const* attribute, Idx size) {
+    detail::check_attribute_type<T>(attribute);
+    return AttributeView<T>{data, size, static_cast<Idx>(sizeof(T))};
+}
+
+// view on the elements of one scenario of a batch
+//    for a uniform component, indptr is empty and every scenario has elements_per_scenario elements
+//    for a non-uniform component, the elements of the scenario are [indptr[scenario], indptr[scenario + 1])
+template <typename T>
+AttributeView<T> scenario_view(AttributeView<T> const& view, Idx scenario, Idx elements_per_scenario,
+                               std::span<Idx const> indptr = {}) {
+    if (indptr.empty()) {
+        return view.subview(scenario * elements_per_scenario, elements_per_scenario);
+    }
+    return view.subview(indptr[scenario], indptr[scenario + 1] - indptr[scenario]);
+}
+
+namespace detail {
+template <typename T, typename DatasetType>
+AttributeView<T> dataset_attribute_view(DatasetType const& dataset, std::string const& component,
+                                        std::string const& attribute) {
+    auto const& info = dataset.get_info();
+    Idx const size = info.component_total_elements(info.component_idx(component));
+    auto const dataset_name = info.name();
+    MetaAttribute const* const meta_attribute = MetaData::get_attribute_by_name(dataset_name, component, attribute);
+    if (auto const data = dataset.get_buffer(component); data != nullptr) {
+        return attribute_view<T>(data, MetaData::get_component_by_name(dataset_name, component), meta_attribute,
+                                 size);
+    }
+    if (auto const data = dataset.get_attribute_buffer(component, attribute); data != nullptr) {
+        return attribute_view<T>(data, meta_attribute, size);
+    }
+    throw AttributeBufferNotFound{component, attribute};
+}
+
+template <typename T, typename DatasetType>
+AttributeView<T> dataset_scenario_view(AttributeView<T> const& view, DatasetType const& dataset,
+                                       std::string const& component, Idx scenario) {
+    auto const& info = dataset.get_info();
+    Idx const elements_per_scenario = info.component_elements_per_scenario(info.component_idx(component));
+    if (elements_per_scenario >= 0) {
+        return scenario_view(view, scenario, elements_per_scenario);
+    }
+    std::span<Idx const> const indptr{dataset.get_indptr(component), static_cast<size_t>(info.batch_size() + 1)};
+    return scenario_view(view, scenario, elements_per_scenario, indptr);
+}
+} // namespace detail
+
+// view on an attribute of all elements of a component in a dataset
+// the component can be row-based or columnar, a columnar component should have a buffer for the attribute
+template <typename T>
+    requires std::is_const_v<T>
+AttributeView<T> attribute_view(DatasetConst const& dataset, std::string const& component,
+                                std::string const& attribute) {
+    return detail::dataset_attribute_view<T>(dataset, component, attribute);
+}
+template <typename T>
+AttributeView<T> attribute_view(DatasetMutable const& dataset, std::string const& component,
+                                std::string const& attribute) {
+    return detail::dataset_attribute_view<T>(dataset, component, attribute);
+}
+
+// view on the elements of one scenario of a component in a batch dataset, the uniformity is taken from the dataset
+template <typename T>
+AttributeView<T> scenario_view(AttributeView<T> const& view, DatasetConst const& dataset, std::string const& component,
+                               Idx scenario) {
+    return detail::dataset_scenario_view(view, dataset, component, scenario);
+}
+template <typename T>
+AttributeView<T> scenario_view(AttributeView<T> const& view, DatasetMutable const& dataset,
+                               std::string const& component, Idx scenario) {
+    return detail::dataset_scenario_view(view, dataset, component, scenario);
+}
+} // namespace power_grid_model_cpp
+
+#endif // POWER_GRID_MODEL_CPP_ATTRIBUTE_VIEW_HPP
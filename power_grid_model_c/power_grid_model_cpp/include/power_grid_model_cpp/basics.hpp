@@ -43,6 +43,9 @@ using RawDatasetInfo = PGM_DatasetInfo;
 using RawOptions = PGM_Options;
 using RawDeserializer = PGM_Deserializer;
 using RawSerializer = PGM_Serializer;
+using RawArrowExporter = PGM_ArrowExporter;
+using RawArrowImporter = PGM_ArrowImporter;
+using RawValidationResult = PGM_ValidationResult;
 
 namespace detail {
 // custom deleter
@@ -16,10 +16,14 @@ class Buffer {
   public:
     Buffer(MetaComponent const* component, Idx size)
         : component_{component}, size_{size}, buffer_{handle_.call_with(PGM_create_buffer, component, size)} {};
+    // create the buffer with the buffer pool of the given handle, see Handle::set_buffer_pool_size()
+    Buffer(MetaComponent const* component, Idx size, Handle const& pool_handle)
+        : component_{component}, size_{size}, buffer_{pool_handle.call_with(PGM_create_buffer, component, size)} {};
 
     RawDataConstPtr get() const { return buffer_.get(); }
     RawDataPtr get() { return buffer_.get(); }
 
+    MetaComponent const* component() const { return component_; }
     Idx size() const { return size_; }
 
     void set_nan() { set_nan(0, size_); }
@@ -27,6 +31,10 @@ class Buffer {
     void set_nan(Idx buffer_offset, Idx size) {
         handle_.call_with(PGM_buffer_set_nan, component_, get(), buffer_offset, size);
     }
+    void set_nan_parallel(Idx threading) { set_nan_parallel(0, size_, threading); }
+    void set_nan_parallel(Idx buffer_offset, Idx size, Idx threading) {
+        handle_.call_with(PGM_buffer_set_nan_parallel, component_, get(), buffer_offset, size, threading);
+    }
 
     void set_value(MetaAttribute const* attribute, RawDataConstPtr src_ptr, Idx src_stride) {
         set_value(attribute, src_ptr, 0, size_, src_stride);
@@ -50,6 +58,28 @@ class Buffer {
         handle_.call_with(PGM_buffer_get_value, attribute, get(), dest_ptr, buffer_offset, size, dest_stride);
     }
 
+    void set_columns(std::vector<MetaAttribute const*> const& attributes, std::vector<RawDataConstPtr> const& src_ptrs,
+                     std::vector<Idx> const& src_strides) {
+        set_columns(attributes, src_ptrs, 0, size_, src_strides);
+    }
+    void set_columns(std::vector<MetaAttribute const*> const& attributes, std::vector<RawDataConstPtr> const& src_ptrs,
+                     Idx buffer_offset, Idx size, std::vector<Idx> const& src_strides) {
+        assert(attributes.size() == src_ptrs.size() && attributes.size() == src_strides.size());
+        handle_.call_with(PGM_buffer_set_columns, static_cast<Idx>(attributes.size()), attributes.data(), get(),
+                          src_ptrs.data(), buffer_offset, size, src_strides.data());
+    }
+
+    void get_columns(std::vector<MetaAttribute const*> const& attributes, std::vector<RawDataPtr> const& dest_ptrs,
+                     std::vector<Idx> const& dest_strides) const {
+        get_columns(attributes, dest_ptrs, 0, size_, dest_strides);
+    }
+    void get_columns(std::vector<MetaAttribute const*> const& attributes, std::vector<RawDataPtr> const& dest_ptrs,
+                     Idx buffer_offset, Idx size, std::vector<Idx> const& dest_strides) const {
+        assert(attributes.size() == dest_ptrs.size() && attributes.size() == dest_strides.size());
+        handle_.call_with(PGM_buffer_get_columns, static_cast<Idx>(attributes.size()), attributes.data(), get(),
+                          dest_ptrs.data(), buffer_offset, size, dest_strides.data());
+    }
+
   private:
     Handle handle_{};
     MetaComponent const* component_;
@@ -9,9 +9,13 @@
 #include "basics.hpp"
 #include "buffer.hpp"
 #include "handle.hpp"
+#include "meta_data.hpp"
+#include "utils.hpp"
 
 #include "power_grid_model_c/dataset.h"
 
+#include <cstddef>
+
 namespace power_grid_model_cpp {
 class ComponentTypeNotFound : public PowerGridError {
   public:
@@ -153,6 +157,21 @@ class DatasetMutable {
 
     DatasetInfo const& get_info() const { return info_; }
 
+    // row-based data of the component, nullptr if the component is columnar
+    RawDataPtr get_buffer(std::string const& component) const {
+        return handle_.call_with(PGM_dataset_mutable_get_buffer, get(), component.c_str());
+    }
+
+    // indptr of the component, nullptr if the component is uniform
+    Idx const* get_indptr(std::string const& component) const {
+        return handle_.call_with(PGM_dataset_mutable_get_indptr, get(), component.c_str());
+    }
+
+    // attribute buffer of a columnar component, nullptr if there is no buffer for the attribute
+    RawDataPtr get_attribute_buffer(std::string const& component, std::string const& attribute) const {
+        return handle_.call_with(PGM_dataset_mutable_get_attribute_buffer, get(), component.c_str(), attribute.c_str());
+    }
+
   private:
     Handle handle_{};
     detail::UniquePtr<RawMutableDataset, &PGM_destroy_dataset_mutable> dataset_;
@@ -198,8 +217,27 @@ class DatasetConst {
                           data.get());
     }
 
+    void convert_to(DatasetMutable const& target, Idx threading = -1) const {
+        handle_.call_with(PGM_dataset_const_convert, get(), target.get(), threading);
+    }
+
     DatasetInfo const& get_info() const { return info_; }
 
+    // row-based data of the component, nullptr if the component is columnar
+    RawDataConstPtr get_buffer(std::string const& component) const {
+        return handle_.call_with(PGM_dataset_const_get_buffer, get(), component.c_str());
+    }
+
+    // indptr of the component, nullptr if the component is uniform
+    Idx const* get_indptr(std::string const& component) const {
+        return handle_.call_with(PGM_dataset_const_get_indptr, get(), component.c_str());
+    }
+
+    // attribute buffer of a columnar component, nullptr if there is no buffer for the attribute
+    RawDataConstPtr get_attribute_buffer(std::string const& component, std::string const& attribute) const {
+        return handle_.call_with(PGM_dataset_const_get_attribute_buffer, get(), component.c_str(), attribute.c_str());
+    }
+
   private:
     Handle handle_{};
     detail::UniquePtr<RawConstDataset, &PGM_destroy_dataset_const> dataset_;
@@ -209,12 +247,49 @@ class DatasetConst {
 struct OwningMemory {
     std::vector<Buffer> buffers;
     std::vector<std::vector<Idx>> indptrs;
+    std::vector<std::vector<std::byte>> attribute_buffers{};
 };
 
 struct OwningDataset {
     DatasetMutable dataset;
     OwningMemory storage{};
 };
+
+// create an owning dataset with new row-based or columnar buffers and convert the data of the source into it
+// the indptrs of the source storage should be in the order of its components, as done by create_owning_dataset()
+// a columnar component gets a buffer for every attribute of the component
+inline OwningDataset convert_owning_dataset(OwningDataset const& source, bool columnar, Idx threading = -1) {
+    auto const& info = source.dataset.get_info();
+    auto const dataset_name = info.name();
+    DatasetMutable dataset_mutable{dataset_name, info.is_batch(), info.batch_size()};
+    OwningMemory storage{};
+
+    for (Idx component_idx{}; component_idx < info.n_components(); ++component_idx) {
+        auto const component_name = info.component_name(component_idx);
+        auto const* const component_meta = MetaData::get_component_by_name(dataset_name, component_name);
+        Idx const component_size = info.component_total_elements(component_idx);
+        Idx const elements_per_scenario = info.component_elements_per_scenario(component_idx);
+
+        auto const& current_indptr = storage.indptrs.emplace_back(source.storage.indptrs.at(component_idx));
+        Idx const* const indptr = current_indptr.empty() ? nullptr : current_indptr.data();
+        if (!columnar) {
+            auto& current_buffer = storage.buffers.emplace_back(component_meta, component_size);
+            dataset_mutable.add_buffer(component_name, elements_per_scenario, component_size, indptr, current_buffer);
+            continue;
+        }
+        dataset_mutable.add_buffer(component_name, elements_per_scenario, component_size, indptr, nullptr);
+        for (Idx attribute_idx{}; attribute_idx < MetaData::n_attributes(component_meta); ++attribute_idx) {
+            auto const* const attribute_meta = MetaData::get_attribute_by_idx(component_meta, attribute_idx);
+            auto const attribute_size =
+                pgm_type_func_selector(attribute_meta, []<typename T>() -> size_t { return sizeof(T); });
+            auto& attribute_buffer = storage.attribute_buffers.emplace_back(attribute_size * component_size);
+            dataset_mutable.add_attribute_buffer(component_name, MetaData::attribute_name(attribute_meta),
+                                                 attribute_buffer.data());
+        }
+    }
+    DatasetConst{source.dataset}.convert_to(dataset_mutable, threading);
+    return OwningDataset{.dataset = std::move(dataset_mutable), .storage = std::move(storage)};
+}
 } // namespace power_grid_model_cpp
 
 #endif // POWER_GRID_MODEL_CPP_DATASET_HPP
@@ -55,6 +55,8 @@ class Handle {
 
     void clear_error() const { PGM_clear_error(get()); }
 
+    void set_buffer_pool_size(Idx max_cached_bytes) const { PGM_set_buffer_pool_size(get(), max_cached_bytes); }
+
     void check_error() const {
         RawHandle const* handle_ptr = get();
         Idx const error_code = PGM_error_code(handle_ptr);
@@ -31,6 +31,10 @@ class Options {
 
     void set_threading(Idx threading) { handle_.call_with(PGM_set_threading, get(), threading); }
 
+    void set_thread_affinity(Idx thread_affinity) {
+        handle_.call_with(PGM_set_thread_affinity, get(), thread_affinity);
+    }
+
     void set_short_circuit_voltage_scaling(Idx short_circuit_voltage_scaling) {
         handle_.call_with(PGM_set_short_circuit_voltage_scaling, get(), short_circuit_voltage_scaling);
     }
@@ -14,6 +14,7 @@
 #include "power_grid_model_c/serialization.h"
 
 #include <cstring>
+#include <filesystem>
 
 namespace power_grid_model_cpp {
 class Deserializer {
@@ -32,14 +33,28 @@ class Deserializer {
                                           serialization_format)},
           dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
 
+    // memory-map the file and parse directly from the mapping
+    static Deserializer from_file(std::filesystem::path const& file_path, Idx serialization_format) {
+        return Deserializer{file_path.string().c_str(), serialization_format, from_file_t{}};
+    }
+
     RawDeserializer* get() { return deserializer_.get(); }
     RawDeserializer const* get() const { return deserializer_.get(); }
 
     DatasetWritable& get_dataset() { return dataset_; }
 
     void parse_to_buffer() { handle_.call_with(PGM_deserializer_parse_to_buffer, get()); }
+    void parse_to_buffer(Idx threading) {
+        handle_.call_with(PGM_deserializer_parse_to_buffer_parallel, get(), threading);
+    }
 
   private:
+    struct from_file_t {};
+
+    Deserializer(char const* file_path, Idx serialization_format, from_file_t /* tag */)
+        : deserializer_{handle_.call_with(PGM_create_deserializer_from_file, file_path, serialization_format)},
+          dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
+
     Handle handle_{};
     detail::UniquePtr<RawDeserializer, &PGM_destroy_deserializer> deserializer_;
     DatasetWritable dataset_;
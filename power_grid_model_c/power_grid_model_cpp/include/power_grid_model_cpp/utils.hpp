@@ -14,6 +14,7 @@
 #include <array>
 #include <complex>
 #include <limits>
+#include <type_traits>
 
 namespace power_grid_model_cpp {
 inline bool is_nan(IntS const x) { return x == std::numeric_limits<IntS>::min(); }
@@ -45,6 +46,22 @@ template <typename T> constexpr T nan_value() {
     }
 }
 
+// the PGM_CType of an attribute value type
+template <typename T> struct pgm_ctype;
+template <> struct pgm_ctype<ID> {
+    static constexpr PGM_CType value = PGM_int32;
+};
+template <> struct pgm_ctype<IntS> {
+    static constexpr PGM_CType value = PGM_int8;
+};
+template <> struct pgm_ctype<double> {
+    static constexpr PGM_CType value = PGM_double;
+};
+template <> struct pgm_ctype<std::array<double, 3>> {
+    static constexpr PGM_CType value = PGM_double3;
+};
+template <typename T> constexpr PGM_CType pgm_ctype_v = pgm_ctype<std::remove_const_t<T>>::value;
+
 class UnsupportedPGM_CType : public PowerGridError {
   public:
     UnsupportedPGM_CType()
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#ifndef POWER_GRID_MODEL_CPP_VALIDATION_HPP
+#define POWER_GRID_MODEL_CPP_VALIDATION_HPP
+
+#include "basics.hpp"
+#include "dataset.hpp"
+#include "handle.hpp"
+
+#include "power_grid_model_c/validation.h"
+
+#include <string>
+#include <vector>
+
+namespace power_grid_model_cpp {
+class ValidationResult {
+  public:
+    ValidationResult(DatasetConst const& dataset, Idx threading = -1)
+        : result_{handle_.call_with(PGM_validate_dataset, dataset.get(), threading)} {}
+
+    RawValidationResult* get() { return result_.get(); }
+    RawValidationResult const* get() const { return result_.get(); }
+
+    bool is_valid() const { return n_errors() == 0; }
+
+    Idx n_errors() const { return handle_.call_with(PGM_validation_result_n_errors, get()); }
+
+    Idx error_type(Idx error_idx) const {
+        return handle_.call_with(PGM_validation_result_error_type, get(), error_idx);
+    }
+
+    std::string component_name(Idx error_idx) const {
+        return std::string{handle_.call_with(PGM_validation_result_component_name, get(), error_idx)};
+    }
+
+    std::string attribute_name(Idx error_idx) const {
+        return std::string{handle_.call_with(PGM_validation_result_attribute_name, get(), error_idx)};
+    }
+
+    std::vector<Idx> elements(Idx error_idx) const {
+        Idx const n_elements = handle_.call_with(PGM_validation_result_n_elements, get(), error_idx);
+        Idx const* const elements = handle_.call_with(PGM_validation_result_elements, get(), error_idx);
+        return {elements, elements + n_elements};
+    }
+
+  private:
+    Handle handle_{};
+    detail::UniquePtr<RawValidationResult, &PGM_destroy_validation_result> result_;
+};
+} // namespace power_grid_model_cpp
+
+#endif // POWER_GRID_MODEL_CPP_VALIDATION_HPP
@@ -4,14 +4,42 @@
 
 #include "fictional_grid_generator.hpp"
 
+#include <power_grid_model/auxiliary/buffer_pool.hpp>
 #include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/auxiliary/serialization/deserializer.hpp>
+#include <power_grid_model/auxiliary/serialization/serializer.hpp>
 #include <power_grid_model/common/common.hpp>
 #include <power_grid_model/common/timer.hpp>
 #include <power_grid_model/main_model.hpp>
 #include <power_grid_model/math_solver/math_solver.hpp>
 
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <new>
 #include <random>
+#include <thread>
+
+namespace power_grid_model::benchmark {
+namespace {
+// number of heap allocations made by the program, counted by the replaced global operator new below
+std::atomic<Idx> n_heap_allocations{0};
+} // namespace
+} // namespace power_grid_model::benchmark
+
+void* operator new(std::size_t count) {
+    ++power_grid_model::benchmark::n_heap_allocations;
+    if (void* ptr = std::malloc(count == 0 ? 1 : count); ptr != nullptr) { // NOLINT(cppcoreguidelines-no-malloc)
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); } // NOLINT(cppcoreguidelines-no-malloc)
+void operator delete(void* ptr, std::size_t /* size */) noexcept {
+    std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc)
+}
 
 namespace power_grid_model::benchmark {
 namespace {
@@ -26,7 +54,8 @@ struct PowerGridBenchmark {
               std::make_unique<MainModel>(50.0, meta_data::meta_data_gen::meta_data, get_math_solver_dispatcher())} {}
 
     template <symmetry_tag sym>
-    void run_pf(CalculationMethod calculation_method, CalculationInfo& info, Idx batch_size = -1, Idx threading = -1) {
+    void run_pf(CalculationMethod calculation_method, CalculationInfo& info, Idx batch_size = -1, Idx threading = -1,
+                ThreadAffinity thread_affinity = ThreadAffinity::none) {
         if (!main_model) {
             std::cout << "\nNo main model available: skipping benchmark.\n";
             return;
@@ -38,14 +67,23 @@ struct PowerGridBenchmark {
         Idx const max_iter = (calculation_method == CalculationMethod::iterative_current) ? 100 : 20;
         try {
             // calculate
+            Idx const n_heap_allocations_before = n_heap_allocations;
             main_model->calculate({.calculation_type = CalculationType::power_flow,
                                    .calculation_symmetry = is_symmetric_v<sym> ? CalculationSymmetry::symmetric
                                                                                : CalculationSymmetry::asymmetric,
                                    .calculation_method = calculation_method,
                                    .err_tol = 1e-8,
                                    .max_iter = max_iter,
-                                   .threading = threading},
+                                   .threading = threading,
+                                   .thread_affinity = thread_affinity},
                                   output.get_dataset(), batch_data.get_dataset());
+            Idx const n_heap_allocations_calculate = n_heap_allocations - n_heap_allocations_before;
+            std::cout << "Number of heap allocations during calculation: " << n_heap_allocations_calculate;
+            if (batch_size > 0) {
+                std::cout << " (" << static_cast<double>(n_heap_allocations_calculate) / static_cast<double>(batch_size)
+                          << " per scenario)";
+            }
+            std::cout << '\n';
             CalculationInfo info_extra = main_model->calculation_info();
             info.merge(info_extra);
         } catch (std::exception const& e) {
@@ -101,6 +139,184 @@ struct PowerGridBenchmark {
         std::cout << "\n\n";
     }
 
+    // scale the number of threads from 1 to all cores, with and without pinning the threads
+    template <symmetry_tag sym>
+    void run_threading_scaling_benchmark(Option const& option, CalculationMethod calculation_method, Idx batch_size) {
+        generator.generate_grid(option, 0);
+        main_model = std::make_unique<MainModel>(50.0, generator.input_data().get_dataset(),
+                                                 get_math_solver_dispatcher());
+        std::cout << "=============Benchmark case: batch scaling over threads=============\n";
+
+        auto const n_cores = std::max(Idx{1}, static_cast<Idx>(std::thread::hardware_concurrency()));
+        std::vector<Idx> n_threads;
+        for (Idx n_thread = 1; n_thread < n_cores; n_thread *= 2) {
+            n_threads.push_back(n_thread);
+        }
+        n_threads.push_back(n_cores);
+
+        auto const run = [this, calculation_method, batch_size](Idx n_thread, ThreadAffinity thread_affinity) {
+            CalculationInfo info;
+            {
+                Timer const t_total(info, 0000, "Total");
+                run_pf<sym>(calculation_method, info, batch_size, n_thread, thread_affinity);
+            }
+            return info;
+        };
+        for (Idx const n_thread : n_threads) {
+            for (auto const thread_affinity : {ThreadAffinity::none, ThreadAffinity::pinned}) {
+                auto const info = run(n_thread, thread_affinity);
+                std::cout << "\n*****Threads: " << n_thread
+                          << (thread_affinity == ThreadAffinity::pinned ? ", pinned" : ", not pinned") << "*****\n";
+                print(info);
+            }
+        }
+        std::cout << "\n\n";
+    }
+
+    // single calculation of a large grid, with the output produced sequentially and in parallel
+    template <symmetry_tag sym>
+    void run_single_threading_benchmark(Option const& option, CalculationMethod calculation_method) {
+        generator.generate_grid(option, 0);
+        main_model = std::make_unique<MainModel>(50.0, generator.input_data().get_dataset(),
+                                                 get_math_solver_dispatcher());
+        std::cout << "=============Benchmark case: large single calculation over threads=============\n";
+
+        for (Idx const threading : {MainModelOptions::sequential, Idx{0}}) {
+            CalculationInfo info;
+            {
+                Timer const t_total(info, 0000, "Total");
+                run_pf<sym>(calculation_method, info, -1, threading);
+            }
+            std::cout << "\n*****Threading: "
+                      << (threading == MainModelOptions::sequential ? "sequential" : "all cores") << "*****\n";
+            print(info);
+        }
+        std::cout << "\n\n";
+    }
+
+    // batch calculation with the full model and with a model trimmed to the component types present in the grid
+    template <symmetry_tag sym>
+    void run_trimmed_model_benchmark(Option const& option, CalculationMethod calculation_method, Idx batch_size) {
+        using GridComponentsModel = TrimmedMainModel<Node, Line, Transformer, Shunt, Source, SymLoad, AsymLoad>;
+
+        generator.generate_grid(option, 0);
+        std::cout << "=============Benchmark case: full versus trimmed component set=============\n";
+
+        auto const run = [this, calculation_method, batch_size]<class Model>(Model& model) {
+            OutputData<sym> output = generator.generate_output_data<sym>(batch_size);
+            BatchData const batch_data = generator.generate_batch_input(batch_size, 0);
+            CalculationInfo info;
+            try {
+                Timer const t_total(info, 0000, "Total");
+                model.calculate({.calculation_type = CalculationType::power_flow,
+                                 .calculation_symmetry = is_symmetric_v<sym> ? CalculationSymmetry::symmetric
+                                                                             : CalculationSymmetry::asymmetric,
+                                 .calculation_method = calculation_method,
+                                 .err_tol = 1e-8,
+                                 .max_iter = 20},
+                                output.get_dataset(), batch_data.get_dataset());
+            } catch (std::exception const& e) {
+                std::cout << "\nAn exception was raised during execution: " << e.what() << '\n';
+            }
+            CalculationInfo info_extra = model.calculation_info();
+            info.merge(info_extra);
+            print(info);
+        };
+
+        MainModel full_model{50.0, generator.input_data().get_dataset(), get_math_solver_dispatcher()};
+        std::cout << "\n*****Full model*****\n";
+        run(full_model);
+
+        GridComponentsModel trimmed_model{50.0, generator.input_data().get_dataset(), get_math_solver_dispatcher()};
+        std::cout << "\n*****Trimmed model*****\n";
+        run(trimmed_model);
+        std::cout << "\n\n";
+    }
+
+    // allocation and first touch of the output buffers of repeated batch calculations, with and without buffer pool
+    void run_buffer_allocation_benchmark(Option const& option, Idx batch_size, Idx n_repeat) {
+        using meta_data::BufferPool;
+        using meta_data::MetaComponent;
+        using meta_data::RawDataPtr;
+
+        generator.generate_grid(option, 0);
+        auto const& input = generator.input_data();
+        auto const& output_dataset = meta_data::meta_data_gen::meta_data.get_dataset("sym_output");
+        std::vector<std::pair<MetaComponent const*, Idx>> const components{
+            {&output_dataset.get_component("node"), static_cast<Idx>(input.node.size())},
+            {&output_dataset.get_component("transformer"), static_cast<Idx>(input.transformer.size())},
+            {&output_dataset.get_component("line"), static_cast<Idx>(input.line.size())},
+            {&output_dataset.get_component("source"), static_cast<Idx>(input.source.size())},
+            {&output_dataset.get_component("sym_load"), static_cast<Idx>(input.sym_load.size())},
+            {&output_dataset.get_component("asym_load"), static_cast<Idx>(input.asym_load.size())},
+            {&output_dataset.get_component("shunt"), static_cast<Idx>(input.shunt.size())}};
+        std::cout << "=============Benchmark case: output buffer allocation=============\n";
+
+        auto const run = [&components, batch_size, n_repeat](std::shared_ptr<BufferPool> const& pool) {
+            CalculationInfo info;
+            std::vector<RawDataPtr> buffers(components.size());
+            for (Idx repeat = 0; repeat < n_repeat; ++repeat) {
+                Timer const t_total(info, 0000, "Total");
+                {
+                    Timer const t_allocate(info, 1000, "Allocate and set nan");
+                    for (size_t idx = 0; idx < components.size(); ++idx) {
+                        auto const& [component, n_elements] = components[idx];
+                        buffers[idx] = meta_data::create_buffer(component->size * n_elements * batch_size,
+                                                                component->alignment, pool);
+                        component->set_nan(buffers[idx], 0, n_elements * batch_size);
+                    }
+                }
+                Timer const t_destroy(info, 2000, "Destroy");
+                std::ranges::for_each(buffers, meta_data::destroy_buffer);
+            }
+            print(info);
+        };
+
+        std::cout << "\n*****Without buffer pool*****\n";
+        run(nullptr);
+        std::cout << "\n*****With buffer pool*****\n";
+        run(std::make_shared<BufferPool>(std::numeric_limits<size_t>::max()));
+        std::cout << "\n\n";
+    }
+
+    // deserialization of a msgpack batch update in compact lists, with and without the attribute decode plan
+    void run_deserialization_benchmark(Option const& option, Idx batch_size, Idx n_repeat) {
+        using meta_data::Deserializer;
+        using meta_data::Serializer;
+
+        generator.generate_grid(option, 0);
+        BatchData const batch_data = generator.generate_batch_input(batch_size, 0);
+        Serializer serializer{batch_data.get_dataset(), SerializationFormat::msgpack};
+        auto const msgpack_data = serializer.get_binary_buffer(true);
+        std::cout << "=============Benchmark case: msgpack deserialization=============\n";
+        std::cout << "Number of bytes: " << msgpack_data.size() << '\n';
+
+        auto const run = [&batch_data, &msgpack_data, n_repeat](bool use_decode_plan) {
+            CalculationInfo info;
+            std::vector<SymLoadGenUpdate> sym_load(batch_data.sym_load.size());
+            std::vector<AsymLoadGenUpdate> asym_load(batch_data.asym_load.size());
+            for (Idx repeat = 0; repeat < n_repeat; ++repeat) {
+                Timer const t_total(info, 0000, "Total");
+                Deserializer deserializer = [&info, &msgpack_data] {
+                    Timer const t_pre_parse(info, 1000, "Pre-parse");
+                    return Deserializer{meta_data::from_msgpack, msgpack_data, meta_data::meta_data_gen::meta_data};
+                }();
+                Timer const t_parse(info, 2000, "Parse");
+                deserializer.use_decode_plan(use_decode_plan);
+                deserializer.get_dataset_info().set_buffer("sym_load", nullptr, sym_load.data());
+                deserializer.get_dataset_info().set_buffer("asym_load", nullptr, asym_load.data());
+                deserializer.parse();
+            }
+            print(info);
+        };
+
+        std::cout << "\n*****Generic visitors*****\n";
+        run(false);
+        std::cout << "\n*****Attribute decode plan*****\n";
+        run(true);
+        std::cout << "\n\n";
+    }
+
     static void print(CalculationInfo const& info) {
         for (auto const& [key, val] : info) {
             std::cout << key << ": " << val << '\n';
@@ -145,6 +361,10 @@ int main(int /* argc */, char** /* argv */) {
     option.has_lv_ring = false;
     benchmarker.run_benchmark<symmetric_t>(option, newton_raphson, batch_size);
     benchmarker.run_benchmark<symmetric_t>(option, newton_raphson, batch_size, 6);
+    benchmarker.run_threading_scaling_benchmark<symmetric_t>(option, newton_raphson, batch_size);
+    benchmarker.run_trimmed_model_benchmark<symmetric_t>(option, linear, batch_size);
+    benchmarker.run_buffer_allocation_benchmark(option, batch_size, 10);
+    benchmarker.run_deserialization_benchmark(option, batch_size, 10);
     benchmarker.run_benchmark<symmetric_t>(option, linear);
     benchmarker.run_benchmark<symmetric_t>(option, iterative_current);
     benchmarker.run_benchmark<asymmetric_t>(option, newton_raphson);
@@ -160,5 +380,14 @@ int main(int /* argc */, char** /* argv */) {
     benchmarker.run_benchmark<asymmetric_t>(option, newton_raphson);
     benchmarker.run_benchmark<asymmetric_t>(option, linear);
     // benchmarker.run_benchmark<asymmetric_t>(option, iterative_current);
+
+    // large single calculation
+    option.has_mv_ring = false;
+    option.has_lv_ring = false;
+#ifdef NDEBUG
+    option.n_node_total_specified = 200000;
+    option.n_mv_feeder = 200;
+#endif
+    benchmarker.run_single_threading_benchmark<symmetric_t>(option, linear);
     return 0;
 }
@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/auxiliary/serialization/arrow_ipc.hpp>
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace power_grid_model::meta_data {
+
+namespace {
+// sym_load with the columns id (int32), name (utf8) and p_specified (float64), written by pyarrow as a stream
+//    the name column has no attribute and the second p_specified is null
+constexpr auto pyarrow_sym_load_stream = std::to_array<unsigned char>({
+    0xff, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x0c, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x03, 0x10, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x70, 0x5f, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xd4, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x01, 0x05, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x08, 0x00, 0x06, 0x00,
+    0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x69, 0x64, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x16, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,});
+
+std::span<char const> as_chars(std::span<unsigned char const> data) {
+    return {reinterpret_cast<char const*>(data.data()), data.size()};
+}
+
+template <class T> T const* attribute_data(ConstDataset const& dataset, std::string_view component,
+                                           std::string_view attribute) {
+    for (auto const& attribute_buffer : dataset.get_buffer(component).attributes) {
+        if (attribute_buffer.meta_attribute->name == attribute) {
+            return static_cast<T const*>(attribute_buffer.data);
+        }
+    }
+    return nullptr;
+}
+
+bool points_into(void const* ptr, std::span<char const> data) {
+    auto const* const char_ptr = static_cast<char const*>(ptr);
+    return char_ptr >= data.data() && char_ptr < data.data() + data.size();
+}
+} // namespace
+
+TEST_CASE("Arrow IPC flatbuffer") {
+    using namespace arrow_ipc;
+
+    std::vector<FlatTable> children;
+    children.push_back(std::move(FlatTable{}.add_string(0, "first")));
+    children.push_back(std::move(FlatTable{}.add_string(0, "second")));
+    FlatTable table;
+    table.add_scalar(0, uint8_t{7})
+        .add_scalar(2, int64_t{-3})
+        .add_string(3, "name")
+        .add_table(4, std::move(FlatTable{}.add_scalar(1, int16_t{5})))
+        .add_tables(5, std::move(children))
+        .add_structs(6, {1, 2, 3, 4}, 2);
+    auto const buffer = FlatBufferWriter::finish(table);
+    CHECK(buffer.size() % alignment == 0);
+
+    auto const view = FlatTableView::root(buffer);
+    CHECK(view.get_scalar(0, uint8_t{}) == 7);
+    CHECK(!view.has_field(1));
+    CHECK(view.get_scalar(1, int32_t{42}) == 42);
+    CHECK(view.get_scalar(2, int64_t{}) == -3);
+    CHECK(view.get_string(3) == "name");
+    CHECK(view.get_table(4).get_scalar(1, int16_t{}) == 5);
+    CHECK(view.get_vector_size(5) == 2);
+    CHECK(view.get_table_at(5, 1).get_string(0) == "second");
+    CHECK(view.get_vector_size(6) == 2);
+    CHECK(view.get_struct_word(6, 1, 2, 0) == 3);
+    CHECK(view.get_struct_word(6, 1, 2, 1) == 4);
+    CHECK_THROWS_AS(view.get_table_at(5, 2), SerializationError);
+    CHECK_THROWS_AS(FlatTableView::root(std::span<char const>{buffer}.first(8)), SerializationError);
+}
+
+TEST_CASE("Arrow IPC") {
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    std::vector<SymLoadGenUpdate> sym_load_gen(4);
+    meta_data_gen::meta_data.get_dataset("update").get_component("sym_load").set_nan(sym_load_gen.data(), 0, 4);
+    sym_load_gen[0].id = 9;
+    sym_load_gen[1].id = 10;
+    sym_load_gen[2].id = 11;
+    sym_load_gen[3].id = 12;
+    sym_load_gen[0].status = 1;
+    sym_load_gen[0].p_specified = 10.0;
+    sym_load_gen[1].p_specified = nan;
+    sym_load_gen[2].p_specified = inf;
+    sym_load_gen[3].p_specified = -inf;
+
+    std::vector<AsymLoadGenUpdate> asym_load_gen(3);
+    meta_data_gen::meta_data.get_dataset("update").get_component("asym_load").set_nan(asym_load_gen.data(), 0, 3);
+    asym_load_gen[0].id = 5;
+    asym_load_gen[1].id = 6;
+    asym_load_gen[2].id = 7;
+    asym_load_gen[0].p_specified = {10.0, 11.0, 12.0};
+    asym_load_gen[1].p_specified = {15.0, nan, 16.0};
+    // nan for asym_load_gen[2].p_specified
+
+    std::vector<ID> const sym_load_gen_id{9, 10, 11, 12};
+    std::vector<double> const sym_load_gen_p_specified{10.0, 11.0, 12.0, 13.0};
+
+    auto const check_sym_load = [&sym_load_gen](ConstDataset const& dataset) {
+        auto const* const id = attribute_data<ID>(dataset, "sym_load", "id");
+        auto const* const status = attribute_data<IntS>(dataset, "sym_load", "status");
+        auto const* const p_specified = attribute_data<double>(dataset, "sym_load", "p_specified");
+        REQUIRE(id != nullptr);
+        REQUIRE(status != nullptr);
+        REQUIRE(p_specified != nullptr);
+        for (Idx idx = 0; idx != 4; ++idx) {
+            CHECK(id[idx] == sym_load_gen[idx].id);
+            CHECK(status[idx] == sym_load_gen[idx].status);
+        }
+        CHECK(p_specified[0] == 10.0);
+        CHECK(is_nan(p_specified[1]));
+        CHECK(p_specified[2] == std::numeric_limits<double>::infinity());
+        CHECK(p_specified[3] == -std::numeric_limits<double>::infinity());
+    };
+
+    for (auto const format : {ArrowIpcFormat::stream, ArrowIpcFormat::file}) {
+        CAPTURE(static_cast<int>(format));
+
+        SUBCASE("Single row-based dataset") {
+            ConstDataset handler{false, 1, "update", meta_data_gen::meta_data};
+            handler.add_buffer("sym_load", 4, 4, nullptr, sym_load_gen.data());
+            handler.add_buffer("asym_load", 3, 3, nullptr, asym_load_gen.data());
+
+            ArrowExporter exporter{handler, format};
+            auto const sym_load_span = exporter.get_component("sym_load");
+            std::vector<char> const sym_load_data{sym_load_span.begin(), sym_load_span.end()};
+            auto const asym_load_span = exporter.get_component("asym_load");
+            std::vector<char> const asym_load_data{asym_load_span.begin(), asym_load_span.end()};
+
+            if (format == ArrowIpcFormat::file) {
+                CHECK(std::string_view{sym_load_data.data(), 6} == "ARROW1");
+                CHECK(std::string_view{sym_load_data.data() + sym_load_data.size() - 6, 6} == "ARROW1");
+            } else {
+                CHECK(std::string_view{sym_load_data.data(), 4} == "\xff\xff\xff\xff");
+            }
+
+            ArrowImporter importer;
+            ConstDataset imported{false, 1, "update", meta_data_gen::meta_data};
+            importer.add_component(imported, "sym_load", sym_load_data);
+            importer.add_component(imported, "asym_load", asym_load_data);
+
+            CHECK(imported.is_columnar("sym_load"));
+            CHECK(imported.get_component_info("sym_load").elements_per_scenario == 4);
+            CHECK(imported.get_buffer("sym_load").attributes.size() ==
+                  meta_data_gen::meta_data.get_dataset("update").get_component("sym_load").attributes.size());
+            check_sym_load(imported);
+            // without nulls, the column is used in place
+            CHECK(points_into(attribute_data<ID>(imported, "sym_load", "id"), sym_load_data));
+            CHECK(!points_into(attribute_data<double>(imported, "sym_load", "p_specified"), sym_load_data));
+
+            auto const* const asym_id = attribute_data<ID>(imported, "asym_load", "id");
+            auto const* const asym_p = attribute_data<RealValue<asymmetric_t>>(imported, "asym_load", "p_specified");
+            REQUIRE(asym_id != nullptr);
+            REQUIRE(asym_p != nullptr);
+            CHECK(asym_id[2] == 7);
+            CHECK(asym_p[0](2) == 12.0);
+            CHECK(asym_p[1](0) == 15.0);
+            CHECK(is_nan(asym_p[1](1)));
+            CHECK(asym_p[1](2) == 16.0);
+            CHECK(is_nan(asym_p[2]));
+        }
+
+        SUBCASE("Batch columnar dataset") {
+            ConstDataset handler{true, 3, "update", meta_data_gen::meta_data};
+            std::array<Idx, 4> const indptr{0, 1, 1, 4};
+            handler.add_buffer("sym_load", -1, 4, indptr.data(), nullptr);
+            handler.add_attribute_buffer("sym_load", "id", sym_load_gen_id.data());
+            handler.add_attribute_buffer("sym_load", "p_specified", sym_load_gen_p_specified.data());
+
+            ArrowExporter exporter{handler, format};
+            auto const span = exporter.get_component("sym_load");
+            std::vector<char> const data{span.begin(), span.end()};
+
+            ArrowImporter importer;
+            ConstDataset imported{true, 3, "update", meta_data_gen::meta_data};
+            importer.add_component(imported, "sym_load", data);
+
+            // one record batch per scenario
+            auto const& buffer = imported.get_buffer("sym_load");
+            CHECK(imported.get_component_info("sym_load").elements_per_scenario == -1);
+            REQUIRE(buffer.indptr.size() == 4);
+            CHECK(buffer.indptr[1] == 1);
+            CHECK(buffer.indptr[2] == 1);
+            CHECK(buffer.indptr[3] == 4);
+            CHECK(buffer.attributes.size() == 2);
+            auto const* const id = attribute_data<ID>(imported, "sym_load", "id");
+            auto const* const p_specified = attribute_data<double>(imported, "sym_load", "p_specified");
+            for (Idx idx = 0; idx != 4; ++idx) {
+                CHECK(id[idx] == sym_load_gen_id[idx]);
+                CHECK(p_specified[idx] == sym_load_gen_p_specified[idx]);
+            }
+
+            // the elements of a single record batch are divided evenly over the scenarios
+            ConstDataset uniform_handler{true, 2, "update", meta_data_gen::meta_data};
+            uniform_handler.add_buffer("sym_load", 2, 4, nullptr, sym_load_gen.data());
+            ArrowExporter uniform_exporter{uniform_handler, format};
+            auto const uniform_span = uniform_exporter.get_component("sym_load");
+            std::vector<char> const uniform_data{uniform_span.begin(), uniform_span.end()};
+            ConstDataset uniform_imported{true, 2, "update", meta_data_gen::meta_data};
+            importer.add_component(uniform_imported, "sym_load", uniform_data);
+            CHECK(uniform_imported.get_component_info("sym_load").elements_per_scenario == 2);
+            check_sym_load(uniform_imported);
+
+            ConstDataset indivisible{true, 3, "update", meta_data_gen::meta_data};
+            CHECK_THROWS_AS(importer.add_component(indivisible, "sym_load", uniform_data), SerializationError);
+        }
+    }
+
+    SUBCASE("Data written by pyarrow") {
+        ArrowImporter importer;
+        ConstDataset imported{false, 1, "update", meta_data_gen::meta_data};
+        importer.add_component(imported, "sym_load", as_chars(pyarrow_sym_load_stream));
+
+        CHECK(imported.get_component_info("sym_load").total_elements == 3);
+        CHECK(imported.get_buffer("sym_load").attributes.size() == 2);
+        auto const* const id = attribute_data<ID>(imported, "sym_load", "id");
+        auto const* const p_specified = attribute_data<double>(imported, "sym_load", "p_specified");
+        REQUIRE(id != nullptr);
+        REQUIRE(p_specified != nullptr);
+        CHECK(id[0] == 9);
+        CHECK(id[2] == 11);
+        CHECK(p_specified[0] == 10.0);
+        CHECK(is_nan(p_specified[1]));
+        CHECK(p_specified[2] == 12.0);
+    }
+
+    SUBCASE("Errors") {
+        ConstDataset handler{false, 1, "update", meta_data_gen::meta_data};
+        handler.add_buffer("sym_load", 4, 4, nullptr, sym_load_gen.data());
+        ArrowExporter exporter{handler, ArrowIpcFormat::stream};
+        auto const span = exporter.get_component("sym_load");
+        std::vector<char> const data{span.begin(), span.end()};
+
+        ArrowImporter importer;
+        ConstDataset imported{false, 1, "update", meta_data_gen::meta_data};
+        // p_specified is a double in sym_load, but three doubles in asym_load
+        CHECK_THROWS_WITH_AS(importer.add_component(imported, "asym_load", data),
+                             "The type of Arrow column p_specified does not match the attribute of component "
+                             "asym_load!\n",
+                             SerializationError);
+        CHECK_THROWS_WITH_AS(importer.add_component(imported, "sym_load", std::span<char const>{data}.first(100)),
+                             "Arrow IPC data is truncated or corrupt!\n", SerializationError);
+        CHECK_THROWS_AS(exporter.get_component("asym_load"), DatasetError);
+        CHECK_THROWS_AS((ArrowExporter{handler, static_cast<ArrowIpcFormat>(5)}), SerializationError);
+    }
+}
+
+} // namespace power_grid_model::meta_data
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/auxiliary/buffer_pool.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace power_grid_model::meta_data {
+namespace {
+bool is_aligned(RawDataPtr ptr, size_t alignment) { return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0; }
+} // namespace
+
+TEST_CASE("Test buffer pool") {
+    SUBCASE("Size classes") {
+        CHECK(detail::size_class_bytes(1) == detail::pool_alignment);
+        CHECK(detail::size_class_bytes(100) == 112);
+        CHECK(detail::size_class_bytes(128) == 128);
+        CHECK(detail::size_class_bytes(129) == 160);
+        CHECK(detail::size_class_bytes(1000) == 1024);
+    }
+
+    SUBCASE("Without pool") {
+        for (size_t const alignment : {size_t{8}, size_t{16}, size_t{256}}) {
+            CAPTURE(alignment);
+            RawDataPtr const ptr = create_buffer(1000, alignment);
+            REQUIRE(ptr != nullptr);
+            CHECK(is_aligned(ptr, alignment));
+            std::memset(ptr, 0, 1000);
+            destroy_buffer(ptr);
+        }
+        destroy_buffer(nullptr);
+    }
+
+    SUBCASE("Reuse of released buffers") {
+        auto const pool = std::make_shared<BufferPool>(size_t{1} << 20);
+        RawDataPtr const first = create_buffer(1000, 8, pool);
+        CHECK(is_aligned(first, detail::pool_alignment));
+        destroy_buffer(first);
+        CHECK(pool->cached_bytes() > 0);
+
+        // same size class
+        RawDataPtr const second = create_buffer(990, 8, pool);
+        CHECK(second == first);
+        CHECK(pool->cached_bytes() == 0);
+
+        // different size class
+        RawDataPtr const third = create_buffer(4000, 8, pool);
+        CHECK(third != first);
+
+        destroy_buffer(second);
+        destroy_buffer(third);
+        pool->clear();
+        CHECK(pool->cached_bytes() == 0);
+    }
+
+    SUBCASE("Full pool") {
+        auto const pool = std::make_shared<BufferPool>(size_t{1000});
+        RawDataPtr const small = create_buffer(100, 8, pool);
+        RawDataPtr const large = create_buffer(10000, 8, pool);
+        destroy_buffer(large);
+        CHECK(pool->cached_bytes() == 0);
+        destroy_buffer(small);
+        CHECK(pool->cached_bytes() > 0);
+    }
+
+    SUBCASE("Buffers outlive the pool owner") {
+        auto pool = std::make_shared<BufferPool>(size_t{1} << 20);
+        RawDataPtr const ptr = create_buffer(1000, 8, pool);
+        pool.reset();
+        destroy_buffer(ptr);
+    }
+
+    SUBCASE("Huge pages") {
+        RawDataPtr const ptr = create_buffer(detail::huge_page_size, 8);
+        REQUIRE(ptr != nullptr);
+        std::memset(ptr, 0, detail::huge_page_size);
+        destroy_buffer(ptr);
+    }
+}
+
+} // namespace power_grid_model::meta_data
@@ -106,6 +106,18 @@ TEST_CASE("Test component container") {
         CHECK(((const_it_end - 6) == it_begin));
     }
 
+    SUBCASE("Test iteration over storage") {
+        auto const storage = const_container.citer_storage<C1>();
+        REQUIRE(storage.size() == 2);
+        CHECK(storage[0].a == 6);
+        CHECK(storage[0].b == 60.0);
+        CHECK(storage[1].a == 66);
+        CHECK(storage[1].b == 660.0);
+        CHECK(&storage[0] == &const_container.get_item_by_seq<C>(const_container.get_start_idx<C, C1>()));
+        CHECK(const_container2.citer_storage<C2>().size() == 1);
+        CHECK(const_container2.citer_storage<C2>()[0].b == 70);
+    }
+
     SUBCASE("Test get item by idx_2d") {
         C const& c = const_container.get_item<C>({.group = 0, .pos = 0});
         C const& c1 = const_container.get_item<C>({.group = 1, .pos = 0});
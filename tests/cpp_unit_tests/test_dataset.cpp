@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include <power_grid_model/auxiliary/dataset.hpp>
+#include <power_grid_model/auxiliary/dataset_conversion.hpp>
 #include <power_grid_model/auxiliary/meta_data.hpp>
 #include <power_grid_model/auxiliary/meta_gen/gen_getters.hpp>
 #include <power_grid_model/common/component_list.hpp>
@@ -1145,4 +1146,124 @@ TEST_CASE("Test writable dataset") {
     }
 }
 
+TEST_CASE("Test dataset conversion") {
+    auto const& dataset_type = test_meta_data_all.datasets.front();
+    CAPTURE(std::string_view{dataset_type.name});
+
+    constexpr Idx batch_size = 2;
+    constexpr Idx elements_per_scenario = 2;
+    constexpr Idx total_elements = batch_size * elements_per_scenario;
+
+    auto const row_buffer = std::vector<A::InputType>{{.id = 1, .a0 = 1.0, .a1 = -1.0},
+                                                      {.id = 2, .a0 = 2.0, .a1 = -2.0},
+                                                      {.id = 3, .a0 = 3.0, .a1 = -3.0},
+                                                      {.id = 4, .a0 = 4.0, .a1 = -4.0}};
+
+    SUBCASE("Row-based to columnar") {
+        auto source = test::create_dataset<ConstDataset>(true, batch_size, dataset_type);
+        source.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, row_buffer.data());
+
+        auto id_buffer = std::vector<ID>(total_elements);
+        auto a1_buffer = std::vector<double>(total_elements);
+        auto target = test::create_dataset<MutableDataset>(true, batch_size, dataset_type);
+        target.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, nullptr);
+        target.add_attribute_buffer(A::name, A::InputType::id_name, id_buffer.data());
+        target.add_attribute_buffer(A::name, A::InputType::a1_name, a1_buffer.data());
+
+        convert_dataset(source, target);
+
+        for (Idx idx = 0; idx < total_elements; ++idx) {
+            CHECK(id_buffer[idx] == row_buffer[idx].id);
+            CHECK(a1_buffer[idx] == row_buffer[idx].a1);
+        }
+    }
+    SUBCASE("Columnar to row-based") {
+        auto const id_buffer = std::vector<ID>{1, 2, 3, 4};
+        auto const a1_buffer = std::vector<double>{-1.0, -2.0, -3.0, -4.0};
+        auto source = test::create_dataset<ConstDataset>(true, batch_size, dataset_type);
+        source.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, nullptr);
+        source.add_attribute_buffer(A::name, A::InputType::id_name, id_buffer.data());
+        source.add_attribute_buffer(A::name, A::InputType::a1_name, a1_buffer.data());
+
+        auto target_buffer = std::vector<A::InputType>(total_elements, {.id = 0, .a0 = 0.0, .a1 = 0.0});
+        auto target = test::create_dataset<MutableDataset>(true, batch_size, dataset_type);
+        target.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, target_buffer.data());
+
+        convert_dataset(source, target);
+
+        for (Idx idx = 0; idx < total_elements; ++idx) {
+            CHECK(target_buffer[idx].id == id_buffer[idx]);
+            test::check_nan(target_buffer[idx].a0);
+            CHECK(target_buffer[idx].a1 == a1_buffer[idx]);
+        }
+    }
+    SUBCASE("Columnar to columnar") {
+        auto const id_buffer = std::vector<ID>{1, 2, 3, 4};
+        auto source = test::create_dataset<ConstDataset>(true, batch_size, dataset_type);
+        source.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, nullptr);
+        source.add_attribute_buffer(A::name, A::InputType::id_name, id_buffer.data());
+
+        auto target_id_buffer = std::vector<ID>(total_elements);
+        auto target_a0_buffer = std::vector<double>(total_elements, 0.0);
+        auto target = test::create_dataset<MutableDataset>(true, batch_size, dataset_type);
+        target.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, nullptr);
+        target.add_attribute_buffer(A::name, A::InputType::id_name, target_id_buffer.data());
+        target.add_attribute_buffer(A::name, A::InputType::a0_name, target_a0_buffer.data());
+
+        convert_dataset(source, target);
+
+        CHECK(target_id_buffer == id_buffer);
+        std::ranges::for_each(target_a0_buffer, test::check_nan);
+    }
+    SUBCASE("Multiple threads") {
+        constexpr Idx large_size = 3 * detail::conversion_block_size + 1;
+        auto source_buffer = std::vector<A::InputType>(large_size);
+        for (Idx idx = 0; idx < large_size; ++idx) {
+            source_buffer[idx] = {.id = static_cast<ID>(idx), .a0 = static_cast<double>(idx), .a1 = nan};
+        }
+        auto source = test::create_dataset<ConstDataset>(false, 1, dataset_type);
+        source.add_buffer(A::name, large_size, large_size, nullptr, source_buffer.data());
+
+        auto a0_buffer = std::vector<double>(large_size);
+        auto target = test::create_dataset<MutableDataset>(false, 1, dataset_type);
+        target.add_buffer(A::name, large_size, large_size, nullptr, nullptr);
+        target.add_attribute_buffer(A::name, A::InputType::a0_name, a0_buffer.data());
+
+        for (Idx const threading : {-1, 0, 2}) {
+            CAPTURE(threading);
+            std::ranges::fill(a0_buffer, 0.0);
+            convert_dataset(source, target, threading);
+            for (Idx idx = 0; idx < large_size; ++idx) {
+                CHECK(a0_buffer[idx] == static_cast<double>(idx));
+            }
+        }
+    }
+    SUBCASE("Incompatible datasets") {
+        auto source = test::create_dataset<ConstDataset>(true, batch_size, dataset_type);
+        source.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, row_buffer.data());
+
+        auto target_buffer = std::vector<A::InputType>(total_elements);
+        SUBCASE("Different batch size") {
+            auto target = test::create_dataset<MutableDataset>(true, 1, dataset_type);
+            target.add_buffer(A::name, total_elements, total_elements, nullptr, target_buffer.data());
+            CHECK_THROWS_AS(convert_dataset(source, target), DatasetError);
+        }
+        SUBCASE("Different number of elements") {
+            auto target = test::create_dataset<MutableDataset>(true, batch_size, dataset_type);
+            target.add_buffer(A::name, 1, batch_size, nullptr, target_buffer.data());
+            CHECK_THROWS_AS(convert_dataset(source, target), DatasetError);
+        }
+        SUBCASE("Missing component") {
+            auto target = test::create_dataset<MutableDataset>(true, batch_size, dataset_type);
+            target.add_buffer(B::name, 0, 0, nullptr, nullptr);
+            CHECK_THROWS_AS(convert_dataset(source, target), DatasetError);
+        }
+        SUBCASE("Columnar buffer without attribute buffers") {
+            auto target = test::create_dataset<MutableDataset>(true, batch_size, dataset_type);
+            target.add_buffer(A::name, elements_per_scenario, total_elements, nullptr, nullptr);
+            CHECK_THROWS_AS(convert_dataset(source, target), DatasetError);
+        }
+    }
+}
+
 } // namespace power_grid_model::meta_data
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/auxiliary/dataset_validation.hpp>
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+
+#include <doctest/doctest.h>
+
+#include <string_view>
+#include <vector>
+
+namespace power_grid_model::meta_data {
+
+namespace {
+template <class T> std::vector<T> nan_input(std::string_view component, Idx size) {
+    std::vector<T> data(size);
+    meta_data_gen::meta_data.get_dataset("input").get_component(component).set_nan(data.data(), 0, size);
+    return data;
+}
+
+ValidationError const* find_error(ValidationResult const& result, ValidationErrorType error_type,
+                                  std::string_view component, std::string_view attribute) {
+    for (auto const& error : result.errors) {
+        if (error.error_type == error_type && error.component->name == component &&
+            error.attribute->name == attribute) {
+            return &error;
+        }
+    }
+    return nullptr;
+}
+
+void check_error(ValidationResult const& result, ValidationErrorType error_type, std::string_view component,
+                 std::string_view attribute, std::vector<Idx> const& elements) {
+    CAPTURE(component);
+    CAPTURE(attribute);
+    auto const* const error = find_error(result, error_type, component, attribute);
+    REQUIRE(error != nullptr);
+    CHECK(error->elements == elements);
+}
+} // namespace
+
+TEST_CASE("Dataset validation") {
+    using enum ValidationErrorType;
+
+    auto node = nan_input<NodeInput>("node", 3);
+    node[0].id = 1;
+    node[0].u_rated = 10.0e3;
+    node[1].id = 2;
+    node[1].u_rated = 10.0e3;
+    node[2].id = 3;
+    node[2].u_rated = 0.4e3;
+
+    auto line = nan_input<LineInput>("line", 2);
+    for (auto& x : line) {
+        x.from_status = 1;
+        x.to_status = 1;
+        x.r1 = 0.1;
+        x.x1 = 0.1;
+        x.c1 = 0.0;
+        x.tan1 = 0.0;
+    }
+    line[0].id = 4;
+    line[0].from_node = 1;
+    line[0].to_node = 2;
+    line[1].id = 5;
+    line[1].from_node = 2;
+    line[1].to_node = 3;
+
+    auto sym_load = nan_input<SymLoadGenInput>("sym_load", 2);
+    for (auto& x : sym_load) {
+        x.node = 3;
+        x.status = 1;
+        x.type = LoadGenType::const_pq;
+        x.p_specified = 1.0e3;
+    }
+    sym_load[0].id = 6;
+    sym_load[1].id = 7;
+
+    auto const validate = [&](Idx threading) {
+        ConstDataset dataset{false, 1, "input", meta_data_gen::meta_data};
+        dataset.add_buffer("node", 3, 3, nullptr, node.data());
+        dataset.add_buffer("line", 2, 2, nullptr, line.data());
+        dataset.add_buffer("sym_load", 2, 2, nullptr, sym_load.data());
+        return validate_dataset(dataset, threading);
+    };
+
+    SUBCASE("Valid data") { CHECK(validate(-1).errors.empty()); }
+
+    SUBCASE("Invalid data") {
+        line[1].id = 1;
+        line[1].to_node = 6;
+        node[2].u_rated = -0.4e3;
+        sym_load[0].status = 2;
+        sym_load[1].type = LoadGenType{na_IntS};
+        sym_load[1].node = 9;
+
+        for (Idx const threading : {-1, 0, 2}) {
+            CAPTURE(threading);
+            auto const result = validate(threading);
+            CHECK(result.errors.size() == 7);
+            check_error(result, not_unique, "node", "id", {0});
+            check_error(result, not_unique, "line", "id", {1});
+            check_error(result, invalid_reference, "line", "to_node", {1});
+            check_error(result, out_of_range, "node", "u_rated", {2});
+            check_error(result, out_of_range, "sym_load", "status", {0});
+            check_error(result, missing_value, "sym_load", "type", {1});
+            check_error(result, invalid_reference, "sym_load", "node", {1});
+        }
+    }
+
+    SUBCASE("Columnar data") {
+        std::vector<ID> const node_id{1, 2, 3};
+        std::vector<ID> const load_id{4, 5, 1};
+        std::vector<ID> const load_node{1, 2, 4};
+        std::vector<double> const load_p{1.0, nan, 2.0};
+
+        ConstDataset dataset{false, 1, "input", meta_data_gen::meta_data};
+        dataset.add_buffer("node", 3, 3, nullptr, nullptr);
+        dataset.add_attribute_buffer("node", "id", node_id.data());
+        dataset.add_buffer("sym_load", 3, 3, nullptr, nullptr);
+        dataset.add_attribute_buffer("sym_load", "id", load_id.data());
+        dataset.add_attribute_buffer("sym_load", "node", load_node.data());
+        dataset.add_attribute_buffer("sym_load", "p_specified", load_p.data());
+
+        auto const result = validate_dataset(dataset);
+        CHECK(result.errors.size() == 6);
+        check_error(result, not_unique, "node", "id", {0});
+        check_error(result, not_unique, "sym_load", "id", {2});
+        check_error(result, invalid_reference, "sym_load", "node", {2});
+        check_error(result, missing_value, "node", "u_rated", {0, 1, 2});
+        check_error(result, missing_value, "sym_load", "status", {0, 1, 2});
+        check_error(result, missing_value, "sym_load", "type", {0, 1, 2});
+    }
+
+    SUBCASE("Batch data") {
+        std::vector<ID> const node_id{1, 2, 1, 1};
+        std::vector<double> const node_u_rated{10.0e3, 10.0e3, 10.0e3, 10.0e3};
+        std::vector<Idx> const indptr{0, 2, 4};
+
+        ConstDataset dataset{true, 2, "input", meta_data_gen::meta_data};
+        dataset.add_buffer("node", -1, 4, indptr.data(), nullptr);
+        dataset.add_attribute_buffer("node", "id", node_id.data());
+        dataset.add_attribute_buffer("node", "u_rated", node_u_rated.data());
+
+        auto const result = validate_dataset(dataset, 0);
+        CHECK(result.errors.size() == 1);
+        check_error(result, not_unique, "node", "id", {2, 3});
+    }
+
+    SUBCASE("Large data") {
+        Idx const size = 3 * validation::block_size + 5;
+        auto large_node = nan_input<NodeInput>("node", size);
+        for (Idx i = 0; i != size; ++i) {
+            large_node[i].id = static_cast<ID>(size - i);
+            large_node[i].u_rated = 10.0e3;
+        }
+        large_node[validation::block_size].u_rated = 0.0;
+        large_node[size - 1].id = 5;
+
+        ConstDataset dataset{false, 1, "input", meta_data_gen::meta_data};
+        dataset.add_buffer("node", size, size, nullptr, large_node.data());
+        for (Idx const threading : {-1, 4}) {
+            auto const result = validate_dataset(dataset, threading);
+            CHECK(result.errors.size() == 2);
+            check_error(result, not_unique, "node", "id", {size - 5, size - 1});
+            check_error(result, out_of_range, "node", "u_rated", {validation::block_size});
+        }
+    }
+
+    SUBCASE("Not an input dataset") {
+        ConstDataset dataset{false, 1, "update", meta_data_gen::meta_data};
+        CHECK_THROWS_AS(validate_dataset(dataset), DatasetError);
+    }
+}
+
+} // namespace power_grid_model::meta_data
@@ -255,13 +255,20 @@ constexpr std::string_view json_batch = R"(
 void check_error(std::string_view json, char const* err_msg) {
     std::vector<NodeInput> node(1);
 
-    auto const run = [&]() {
-        Deserializer deserializer{from_json, json, meta_data_gen::meta_data};
-        deserializer.get_dataset_info().set_buffer("node", nullptr, node.data());
-        deserializer.parse();
-    };
-
-    CHECK_THROWS_WITH_AS(run(), doctest::Contains(err_msg), std::exception);
+    for (Idx const threading : {-1, 2}) {
+        for (bool const decode_plan : {true, false}) {
+            CAPTURE(threading);
+            CAPTURE(decode_plan);
+            auto const run = [&]() {
+                Deserializer deserializer{from_json, json, meta_data_gen::meta_data};
+                deserializer.get_dataset_info().set_buffer("node", nullptr, node.data());
+                deserializer.use_decode_plan(decode_plan);
+                deserializer.parse(threading);
+            };
+
+            CHECK_THROWS_WITH_AS(run(), doctest::Contains(err_msg), std::exception);
+        }
+    }
 }
 
 } // namespace
@@ -324,7 +331,11 @@ TEST_CASE("Deserializer") {
             info.set_buffer("source", nullptr, source.data());
             info.set_buffer("sym_load", nullptr, sym_load.data());
 
-            deserializer.parse();
+            SUBCASE("Decode plan") { deserializer.parse(); }
+            SUBCASE("Generic visitors") {
+                deserializer.use_decode_plan(false);
+                deserializer.parse();
+            }
             // check node
             CHECK(node[0].id == 1);
             CHECK(node[0].u_rated == doctest::Approx(10.5e3));
@@ -400,7 +411,11 @@ TEST_CASE("Deserializer") {
             info.set_attribute_buffer("sym_load", "p_specified", sym_load_p_specified.data());
             info.set_attribute_buffer("sym_load", "q_specified", sym_load_q_specified.data());
 
-            deserializer.parse();
+            SUBCASE("Decode plan") { deserializer.parse(); }
+            SUBCASE("Generic visitors") {
+                deserializer.use_decode_plan(false);
+                deserializer.parse();
+            }
             // check node
             CHECK(node_id[0] == 1);
             CHECK(node_u_rated[0] == doctest::Approx(10.5e3));
@@ -471,7 +486,8 @@ TEST_CASE("Deserializer") {
             info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
             info.set_buffer("asym_load", nullptr, asym_load.data());
 
-            deserializer.parse();
+            SUBCASE("Sequential") { deserializer.parse(); }
+            SUBCASE("Parallel") { deserializer.parse(3); }
 
             // sym_load
             CHECK(sym_load_indptr == IdxVector{0, 1, 1, 3, 4});
@@ -536,7 +552,8 @@ TEST_CASE("Deserializer") {
             info.set_attribute_buffer("asym_load", "p_specified", asym_load_p_specified.data());
             info.set_attribute_buffer("asym_load", "q_specified", asym_load_q_specified.data());
 
-            deserializer.parse();
+            SUBCASE("Sequential") { deserializer.parse(); }
+            SUBCASE("Parallel") { deserializer.parse(3); }
 
             // sym_load
             CHECK(sym_load_indptr == IdxVector{0, 1, 1, 3, 4});
@@ -611,6 +628,10 @@ TEST_CASE("Deserializer with error") {
             R"({"version": "1.0", "type": "input", "is_batch": false, "attributes": {"node": ["id"]}, "data": {"node":
 [[true]]}})";
         check_error(wrong_type_list, "Position of error: data/node/0/0");
+        constexpr std::string_view overflow_list =
+            R"({"version": "1.0", "type": "input", "is_batch": false, "attributes": {"node": ["id"]}, "data": {"node":
+[[3000000000]]}})";
+        check_error(overflow_list, "Integer value overflows the data type!");
         constexpr std::string_view wrong_type_dict =
             R"({"version": "1.0", "type": "input", "is_batch": false, "attributes": {}, "data": {"node": [{"id":
 true}]}})";
@@ -81,6 +81,21 @@ TEST_CASE("Test main core output") {
             CHECK(output[1].energized == 1);
             CHECK(output[1].tap_pos == 1);
         }
+        SUBCASE("Output range") {
+            OptimizerOutput const optimizer_output{
+                .transformer_tap_positions = {{.transformer_id = 3, .tap_position = 1},
+                                              {.transformer_id = 2, .tap_position = 3}}};
+            auto const res_it = output_result<TransformerTapRegulator, ComponentContainer>(
+                state, SymOutput{.solver_output = {}, .optimizer_output = optimizer_output}, std::begin(output) + 1,
+                detail::OutputRange{.begin = 1, .end = 2});
+            CHECK(res_it == std::end(output));
+            CHECK(output[0].id == na_IntID);
+            CHECK(output[0].energized == na_IntS);
+            CHECK(output[0].tap_pos == na_IntS);
+            CHECK(output[1].id == 1);
+            CHECK(output[1].energized == 1);
+            CHECK(output[1].tap_pos == 1);
+        }
     }
 }
 } // namespace power_grid_model::main_core
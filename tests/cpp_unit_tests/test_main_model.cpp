@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/main_model.hpp>
+#include <power_grid_model/math_solver/math_solver.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+namespace power_grid_model {
+namespace {
+MathSolverDispatcher const& get_math_solver_dispatcher() {
+    static constexpr MathSolverDispatcher math_solver_dispatcher{math_solver::math_solver_tag<MathSolver>{}};
+    return math_solver_dispatcher;
+}
+
+// source - node 1 - line 3 - node 2 - sym_load 5
+struct SimpleGrid {
+    std::vector<NodeInput> node{{.id = 1, .u_rated = 10e3}, {.id = 2, .u_rated = 10e3}};
+    std::vector<LineInput> line{{.id = 3,
+                                 .from_node = 1,
+                                 .to_node = 2,
+                                 .from_status = 1,
+                                 .to_status = 1,
+                                 .r1 = 0.5,
+                                 .x1 = 0.5,
+                                 .c1 = 0.0,
+                                 .tan1 = 0.0,
+                                 .r0 = nan,
+                                 .x0 = nan,
+                                 .c0 = nan,
+                                 .tan0 = nan,
+                                 .i_n = 1e3}};
+    std::vector<SourceInput> source{{.id = 4,
+                                     .node = 1,
+                                     .status = 1,
+                                     .u_ref = 1.0,
+                                     .u_ref_angle = nan,
+                                     .sk = 1e20,
+                                     .rx_ratio = nan,
+                                     .z01_ratio = nan}};
+    std::vector<SymLoadGenInput> sym_load{
+        {.id = 5, .node = 2, .status = 1, .type = LoadGenType::const_pq, .p_specified = 1e6, .q_specified = 0.2e6}};
+    std::vector<SymVoltageSensorInput> sym_voltage_sensor{
+        {.id = 6, .measured_object = 1, .u_sigma = 1.0, .u_measured = 10e3, .u_angle_measured = nan}};
+
+    ConstDataset get_input_dataset(bool with_sensor) const {
+        ConstDataset dataset{false, 1, "input", meta_data::meta_data_gen::meta_data};
+        dataset.add_buffer("node", std::ssize(node), std::ssize(node), nullptr, node.data());
+        dataset.add_buffer("line", std::ssize(line), std::ssize(line), nullptr, line.data());
+        dataset.add_buffer("source", std::ssize(source), std::ssize(source), nullptr, source.data());
+        dataset.add_buffer("sym_load", std::ssize(sym_load), std::ssize(sym_load), nullptr, sym_load.data());
+        if (with_sensor) {
+            dataset.add_buffer("sym_voltage_sensor", std::ssize(sym_voltage_sensor), std::ssize(sym_voltage_sensor),
+                               nullptr, sym_voltage_sensor.data());
+        }
+        return dataset;
+    }
+};
+
+template <class Model> std::vector<NodeOutput<symmetric_t>> run_power_flow(Model& model) {
+    std::vector<NodeOutput<symmetric_t>> node_output(2);
+    MutableDataset result_data{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+    result_data.add_buffer("node", std::ssize(node_output), std::ssize(node_output), nullptr, node_output.data());
+    model.calculate({.calculation_type = CalculationType::power_flow,
+                     .calculation_symmetry = CalculationSymmetry::symmetric,
+                     .calculation_method = CalculationMethod::newton_raphson},
+                    result_data, ConstDataset{true, 1, "update", meta_data::meta_data_gen::meta_data});
+    return node_output;
+}
+} // namespace
+
+TEST_CASE("Test trimmed main model") {
+    using PowerFlowModel = BasicMainModel<PowerFlowComponents>;
+
+    SimpleGrid const grid{};
+
+    SUBCASE("Same result as the full model") {
+        MainModel full_model{50.0, grid.get_input_dataset(false), get_math_solver_dispatcher()};
+        PowerFlowModel power_flow_model{50.0, grid.get_input_dataset(false), get_math_solver_dispatcher()};
+        TrimmedMainModel<Node, Line, Shunt, Source, SymLoad> trimmed_model{50.0, grid.get_input_dataset(false),
+                                                                           get_math_solver_dispatcher()};
+
+        auto const full_output = run_power_flow(full_model);
+        auto const power_flow_output = run_power_flow(power_flow_model);
+        auto const trimmed_output = run_power_flow(trimmed_model);
+        for (Idx i = 0; i != std::ssize(full_output); ++i) {
+            CHECK(full_output[i].energized == 1);
+            CHECK(power_flow_output[i].u == doctest::Approx(full_output[i].u));
+            CHECK(power_flow_output[i].u_angle == doctest::Approx(full_output[i].u_angle));
+            CHECK(trimmed_output[i].u == doctest::Approx(full_output[i].u));
+            CHECK(trimmed_output[i].u_angle == doctest::Approx(full_output[i].u_angle));
+        }
+        CHECK(full_output[1].u < full_output[0].u);
+    }
+
+    SUBCASE("Unsupported component in input data") {
+        CHECK_NOTHROW(MainModel(50.0, grid.get_input_dataset(true), get_math_solver_dispatcher()));
+        CHECK_THROWS_AS(PowerFlowModel(50.0, grid.get_input_dataset(true), get_math_solver_dispatcher()),
+                        DatasetError);
+    }
+
+    SUBCASE("Unsupported component in update data") {
+        PowerFlowModel power_flow_model{50.0, grid.get_input_dataset(false), get_math_solver_dispatcher()};
+
+        std::vector<SymVoltageSensorUpdate> sym_voltage_sensor_update{
+            {.id = 6, .u_sigma = 2.0, .u_measured = nan, .u_angle_measured = nan}};
+        ConstDataset update_data{false, 1, "update", meta_data::meta_data_gen::meta_data};
+        update_data.add_buffer("sym_voltage_sensor", 1, 1, nullptr, sym_voltage_sensor_update.data());
+        CHECK_THROWS_AS(power_flow_model.update_components<permanent_update_t>(update_data), DatasetError);
+
+        std::vector<SymLoadGenUpdate> sym_load_update{
+            {.id = 5, .status = na_IntS, .p_specified = 2e6, .q_specified = nan}};
+        ConstDataset supported_update_data{false, 1, "update", meta_data::meta_data_gen::meta_data};
+        supported_update_data.add_buffer("sym_load", 1, 1, nullptr, sym_load_update.data());
+        CHECK_NOTHROW(power_flow_model.update_components<permanent_update_t>(supported_update_data));
+    }
+}
+
+} // namespace power_grid_model
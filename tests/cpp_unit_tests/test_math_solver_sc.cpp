@@ -281,6 +281,52 @@ TEST_CASE("Short circuit solver") {
         assert_sc_output<asymmetric_t>(output, sc_output_ref);
     }
 
+    SUBCASE("Test short circuit solver fault impedance sweep") {
+        // consecutive calculations with the same solver reuse the pre-fault factorization
+        std::vector<DoubleComplex> const z_fault_sweep{z_fault, 2.0 * z_fault, 0.1 + 0.0i, 5.0 - 2.0i};
+
+        SUBCASE("Symmetric") {
+            YBus<symmetric_t> const y_bus_sym{topo_sc_ptr, param_sym_ptr};
+            ShortCircuitSolver<symmetric_t> solver{y_bus_sym, topo_sc_ptr};
+            for (DoubleComplex const& z_fault_value : z_fault_sweep) {
+                CAPTURE(z_fault_value);
+                auto sc_input = create_sc_test_input(three_phase, FaultPhase::abc, 1.0 / z_fault_value, vref,
+                                                     fault_buses);
+                auto sc_output_ref =
+                    create_sc_test_output<symmetric_t>(three_phase, z_fault_value, z0, z0_0, vref, zref);
+                auto output = solver.run_short_circuit(y_bus_sym, sc_input);
+                assert_sc_output<symmetric_t>(output, sc_output_ref);
+            }
+        }
+
+        SUBCASE("Asymmetric") {
+            YBus<asymmetric_t> const y_bus_asym{topo_sc_ptr, param_asym_ptr};
+            ShortCircuitSolver<asymmetric_t> solver{y_bus_asym, topo_sc_ptr};
+            // the two phase to ground fault and the solid fault are calculated with a full factorization in between
+            std::vector<std::pair<FaultType, FaultPhase>> const fault_types{{three_phase, FaultPhase::abc},
+                                                                            {single_phase_to_ground, FaultPhase::a},
+                                                                            {two_phase_to_ground, FaultPhase::bc},
+                                                                            {two_phase, FaultPhase::bc}};
+            for (auto const& [fault_type, fault_phase] : fault_types) {
+                for (DoubleComplex const& z_fault_value : z_fault_sweep) {
+                    CAPTURE(fault_type);
+                    CAPTURE(z_fault_value);
+                    auto sc_input =
+                        create_sc_test_input(fault_type, fault_phase, 1.0 / z_fault_value, vref, fault_buses);
+                    auto sc_output_ref =
+                        create_sc_test_output<asymmetric_t>(fault_type, z_fault_value, z0, z0_0, vref, zref);
+                    auto output = solver.run_short_circuit(y_bus_asym, sc_input);
+                    assert_sc_output<asymmetric_t>(output, sc_output_ref);
+                }
+                auto sc_input_solid = create_sc_test_input(fault_type, fault_phase, y_fault_solid, vref, fault_buses);
+                auto sc_output_solid_ref =
+                    create_sc_test_output<asymmetric_t>(fault_type, z_fault_solid, z0, z0_0, vref, zref);
+                auto output_solid = solver.run_short_circuit(y_bus_asym, sc_input_solid);
+                assert_sc_output<asymmetric_t>(output_solid, sc_output_solid_ref);
+            }
+        }
+    }
+
     SUBCASE("Test short circuit solver no faults") {
         YBus<symmetric_t> const y_bus_sym{topo_sc_ptr, param_sym_ptr};
         YBus<asymmetric_t> const y_bus_asym{topo_sc_ptr, param_asym_ptr};
@@ -8,14 +8,98 @@
 
 #include <doctest/doctest.h>
 
+namespace power_grid_model::math_solver {
+namespace {
+// iterative linear state estimation with bad data detection enabled
+template <symmetry_tag sym> class BadDataIterativeLinearSESolver : public IterativeLinearSESolver<sym> {
+  public:
+    BadDataIterativeLinearSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr)
+        : IterativeLinearSESolver<sym>{y_bus, std::move(topo_ptr), BadDataDetection{.max_bad_data = 3}} {}
+};
+} // namespace
+} // namespace power_grid_model::math_solver
+
 TYPE_TO_STRING_AS("IterativeLinearSESolver<symmetric_t>",
                   power_grid_model::math_solver::IterativeLinearSESolver<power_grid_model::symmetric_t>);
 TYPE_TO_STRING_AS("IterativeLinearSESolver<asymmetric_t>",
                   power_grid_model::math_solver::IterativeLinearSESolver<power_grid_model::asymmetric_t>);
+TYPE_TO_STRING_AS("BadDataIterativeLinearSESolver<symmetric_t>",
+                  power_grid_model::math_solver::BadDataIterativeLinearSESolver<power_grid_model::symmetric_t>);
+TYPE_TO_STRING_AS("BadDataIterativeLinearSESolver<asymmetric_t>",
+                  power_grid_model::math_solver::BadDataIterativeLinearSESolver<power_grid_model::asymmetric_t>);
 
 namespace power_grid_model::math_solver {
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, IterativeLinearSESolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, IterativeLinearSESolver<asymmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_zero_variance_id, IterativeLinearSESolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_measurements_id, IterativeLinearSESolver<symmetric_t>);
+
+// without bad data, the detection should not change the result
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, BadDataIterativeLinearSESolver<symmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, BadDataIterativeLinearSESolver<asymmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_zero_variance_id, BadDataIterativeLinearSESolver<symmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_measurements_id, BadDataIterativeLinearSESolver<symmetric_t>);
+
+TEST_CASE_TEMPLATE("Test math solver - SE, bad data detection", sym, symmetric_t, asymmetric_t) {
+    constexpr auto error_tolerance{1e-10};
+    constexpr auto num_iter{20};
+
+    SESolverTestGrid<sym> const grid;
+    auto const output_ref = grid.output_ref();
+
+    // topo and param ptr
+    auto param_ptr = std::make_shared<MathModelParam<sym> const>(grid.param());
+    auto topo_ptr = std::make_shared<MathModelTopology const>(grid.topo());
+    YBus<sym> const y_bus{topo_ptr, param_ptr};
+
+    // gross error of 10 sigma in the redundant from-side power measurement of branch 0
+    auto se_input = grid.se_input_angle();
+    auto& branch_from_power = se_input.measured_branch_from_power.front();
+    branch_from_power.real_component.value += RealValue<sym>{10.0};
+    branch_from_power.imag_component.value -= RealValue<sym>{10.0};
+
+    auto const max_branch_power_error = [&output_ref](SolverOutput<sym> const& output) {
+        double result = 0.0;
+        for (size_t branch = 0; branch != output.branch.size(); ++branch) {
+            result = std::max(result, max_val(cabs(output.branch[branch].s_f - output_ref.branch[branch].s_f)));
+            result = std::max(result, max_val(cabs(output.branch[branch].s_t - output_ref.branch[branch].s_t)));
+        }
+        return result;
+    };
+    auto const bad_data_key = Timer::make_key(2230, "Number of reweighted bad data measurements");
+
+    IterativeLinearSESolver<sym> solver{y_bus, topo_ptr};
+    CalculationInfo info;
+    auto const output = solver.run_state_estimation(y_bus, se_input, error_tolerance, num_iter, info);
+    CHECK(!info.contains(bad_data_key));
+
+    SUBCASE("Reweight the worst measurement") {
+        IterativeLinearSESolver<sym> bad_data_solver{y_bus, topo_ptr, BadDataDetection{.max_bad_data = 1}};
+        CalculationInfo bad_data_info;
+        auto const bad_data_output =
+            bad_data_solver.run_state_estimation(y_bus, se_input, error_tolerance, num_iter, bad_data_info);
+        CHECK(bad_data_info.at(bad_data_key) == 1.0);
+        CHECK(max_branch_power_error(bad_data_output) < 0.1 * max_branch_power_error(output));
+    }
+
+    SUBCASE("Stop when no bad data is left") {
+        IterativeLinearSESolver<sym> bad_data_solver{y_bus, topo_ptr, BadDataDetection{.max_bad_data = 100}};
+        CalculationInfo bad_data_info;
+        auto const bad_data_output =
+            bad_data_solver.run_state_estimation(y_bus, se_input, error_tolerance, num_iter, bad_data_info);
+        CHECK(bad_data_info.at(bad_data_key) > 1.0);
+        CHECK(bad_data_info.at(bad_data_key) < 100.0);
+        CHECK(max_branch_power_error(bad_data_output) < 0.1 * max_branch_power_error(output));
+    }
+
+    SUBCASE("Threshold above the largest normalized residual") {
+        IterativeLinearSESolver<sym> bad_data_solver{y_bus, topo_ptr,
+                                                     BadDataDetection{.max_bad_data = 1, .threshold = 1e3}};
+        CalculationInfo bad_data_info;
+        auto const bad_data_output =
+            bad_data_solver.run_state_estimation(y_bus, se_input, error_tolerance, num_iter, bad_data_info);
+        CHECK(bad_data_info.at(bad_data_key) == 0.0);
+        assert_output(bad_data_output, output);
+    }
+}
 } // namespace power_grid_model::math_solver
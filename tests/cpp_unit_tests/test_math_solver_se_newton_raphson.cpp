@@ -13,9 +13,30 @@ TYPE_TO_STRING_AS("NewtonRaphsonSESolver<symmetric_t>",
 TYPE_TO_STRING_AS("NewtonRaphsonSESolver<asymmetric_t>",
                   power_grid_model::math_solver::NewtonRaphsonSESolver<power_grid_model::asymmetric_t>);
 
+namespace power_grid_model::math_solver {
+namespace {
+// Newton-Raphson state estimation reusing the gain matrix factorization across iterations
+template <symmetry_tag sym> class QuasiNewtonRaphsonSESolver : public NewtonRaphsonSESolver<sym> {
+  public:
+    QuasiNewtonRaphsonSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr)
+        : NewtonRaphsonSESolver<sym>{y_bus, std::move(topo_ptr), NRSEFactorization::on_slow_convergence} {}
+};
+} // namespace
+} // namespace power_grid_model::math_solver
+
+TYPE_TO_STRING_AS("QuasiNewtonRaphsonSESolver<symmetric_t>",
+                  power_grid_model::math_solver::QuasiNewtonRaphsonSESolver<power_grid_model::symmetric_t>);
+TYPE_TO_STRING_AS("QuasiNewtonRaphsonSESolver<asymmetric_t>",
+                  power_grid_model::math_solver::QuasiNewtonRaphsonSESolver<power_grid_model::asymmetric_t>);
+
 namespace power_grid_model::math_solver {
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, NewtonRaphsonSESolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, NewtonRaphsonSESolver<asymmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_zero_variance_id, NewtonRaphsonSESolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_measurements_id, NewtonRaphsonSESolver<symmetric_t>);
+
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, QuasiNewtonRaphsonSESolver<symmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, QuasiNewtonRaphsonSESolver<asymmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_zero_variance_id, QuasiNewtonRaphsonSESolver<symmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_measurements_id, QuasiNewtonRaphsonSESolver<symmetric_t>);
 } // namespace power_grid_model::math_solver
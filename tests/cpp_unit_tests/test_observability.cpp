@@ -172,5 +172,155 @@ TEST_CASE("Necessary observability check") {
             }
         }
     }
+    SUBCASE("Cached observability") {
+        auto topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        YBus<symmetric_t> const y_bus{topo_ptr, param};
+        math_solver::ObservabilityCache cache;
+
+        auto const check_cached = [&cache, &y_bus](StateEstimationInput<symmetric_t> const& input) {
+            math_solver::MeasuredValues<symmetric_t> const measured_values{y_bus.shared_topology(), input};
+            auto const result = cache.check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+            auto const reference = math_solver::necessary_observability_check(measured_values, y_bus.math_topology(),
+                                                                              y_bus.y_bus_structure());
+            CHECK(result.is_sufficiently_observable == reference.is_sufficiently_observable);
+            CHECK(result.is_possibly_ill_conditioned == reference.is_possibly_ill_conditioned);
+        };
+
+        check_cached(se_input);
+
+        // other measured values of the same sensors
+        se_input.measured_voltage = {{.value = 1.05 + 0.5i, .variance = 0.5}};
+        se_input.measured_branch_from_power = {
+            {.real_component = {.value = 2.0, .variance = 0.5}, .imag_component = {.value = 1.0, .variance = 0.5}}};
+        check_cached(se_input);
+
+        // the bus injection sensor becomes invalid, so the grid is not observable anymore
+        constexpr auto inf = std::numeric_limits<double>::infinity();
+        auto const observable_bus_injection = se_input.measured_bus_injection;
+        se_input.measured_bus_injection = {
+            {.real_component = {.value = 1.0, .variance = inf}, .imag_component = {.value = 0.0, .variance = inf}}};
+        math_solver::MeasuredValues<symmetric_t> const unobservable{y_bus.shared_topology(), se_input};
+        CHECK_THROWS_AS(cache.check(unobservable, y_bus.math_topology(), y_bus.y_bus_structure()),
+                        NotObservableError);
+        CHECK_THROWS_AS(cache.check(unobservable, y_bus.math_topology(), y_bus.y_bus_structure()),
+                        NotObservableError);
+
+        se_input.measured_bus_injection = observable_bus_injection;
+        check_cached(se_input);
+    }
+}
+
+TEST_CASE("Necessary observability check - meshed grid") {
+    /*
+            bus_0 --branch_0-- bus_1
+              |  \               |
+        branch_3  branch_4    branch_1
+              |          \      |
+            bus_3 --branch_2-- bus_2
+
+        source and load_gen 0 at bus_0, load_gen i at bus_i
+    */
+    MathModelTopology topo;
+    topo.slack_bus = 0;
+    topo.is_radial = false;
+    topo.phase_shift = {0.0, 0.0, 0.0, 0.0};
+    topo.branch_bus_idx = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 2}};
+    topo.sources_per_bus = {from_dense, {0}, 4};
+    topo.shunts_per_bus = {from_dense, {}, 4};
+    topo.load_gens_per_bus = {from_dense, {0, 1, 2, 3}, 4};
+    topo.load_gen_type = {LoadGenType::const_pq, LoadGenType::const_pq, LoadGenType::const_pq,
+                          LoadGenType::const_pq};
+    topo.power_sensors_per_source = {from_dense, {}, 1};
+    topo.power_sensors_per_load_gen = {from_dense, {}, 4};
+    topo.power_sensors_per_shunt = {from_dense, {}, 0};
+    // flow sensors on branch 0, 1 and 4 all lie within bus_0, bus_1 and bus_2
+    topo.power_sensors_per_branch_from = {from_dense, {0, 1, 4}, 5};
+    topo.power_sensors_per_branch_to = {from_dense, {}, 5};
+    topo.current_sensors_per_branch_from = {from_dense, {}, 5};
+    topo.current_sensors_per_branch_to = {from_dense, {}, 5};
+    topo.voltage_sensors_per_bus = {from_dense, {0}, 4};
+
+    MathModelParam<symmetric_t> param;
+    param.source_param = {SourceCalcParam{.y1 = 10.0 - 50.0i, .y0 = 10.0 - 50.0i}};
+    param.branch_param = {{1.0, -1.0, -1.0, 1.0},
+                          {1.0, -1.0, -1.0, 1.0},
+                          {1.0, -1.0, -1.0, 1.0},
+                          {1.0, -1.0, -1.0, 1.0},
+                          {1.0, -1.0, -1.0, 1.0}};
+
+    DecomposedComplexRandVar<symmetric_t> const power_measurement{.real_component = {.value = 1.0, .variance = 1.0},
+                                                                  .imag_component = {.value = 0.0, .variance = 1.0}};
+
+    StateEstimationInput<symmetric_t> se_input;
+    se_input.source_status = {1};
+    se_input.load_gen_status = {1, 1, 1, 1};
+    se_input.measured_voltage = {{.value = {1.0, nan}, .variance = 1.0}};
+    se_input.measured_bus_injection = {power_measurement};
+    se_input.measured_branch_from_power = {power_measurement, power_measurement, power_measurement};
+
+    auto const check = [&topo, &param, &se_input]() {
+        auto topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        YBus<symmetric_t> const y_bus{topo_ptr, std::make_shared<MathModelParam<symmetric_t> const>(param)};
+        math_solver::MeasuredValues<symmetric_t> const measured_values{y_bus.shared_topology(), se_input};
+        return math_solver::necessary_observability_check(measured_values, y_bus.math_topology(),
+                                                          y_bus.y_bus_structure());
+    };
+
+    SUBCASE("Injection sensor connects the islands") {
+        // bus_0 is adjacent to bus_3
+        topo.power_sensors_per_bus = {from_dense, {0}, 4};
+        CHECK(check().is_sufficiently_observable);
+    }
+    SUBCASE("Injection sensor within an island") {
+        // bus_1 is only adjacent to bus_0 and bus_2, the angle of bus_3 is undetermined
+        // the number of sensors is sufficient, but the islands cannot be connected
+        topo.power_sensors_per_bus = {from_dense, {1}, 4};
+        CHECK_THROWS_AS(check(), NotObservableError);
+    }
+    SUBCASE("Voltage phasor sensor in each island") {
+        topo.power_sensors_per_bus = {from_dense, {1}, 4};
+        topo.voltage_sensors_per_bus = {from_dense, {0, 3}, 4};
+        se_input.measured_voltage = {{.value = 1.0, .variance = 1.0}, {.value = 1.0, .variance = 1.0}};
+        auto const result = check();
+        CHECK_FALSE(result.is_sufficiently_observable);
+    }
+    SUBCASE("Cached observability with a moving global angle current sensor") {
+        using enum AngleMeasurementType;
+
+        // current sensors on branch 0 and branch 2 make the islands {bus_0, bus_1} and {bus_2, bus_3}
+        // voltage phasor sensors on bus_0 and bus_1, no injection sensors
+        topo.power_sensors_per_bus = {from_dense, {}, 4};
+        topo.power_sensors_per_branch_from = {from_dense, {}, 5};
+        topo.current_sensors_per_branch_from = {from_dense, {0, 2}, 5};
+        topo.voltage_sensors_per_bus = {from_dense, {0, 1}, 4};
+        se_input.measured_bus_injection = {};
+        se_input.measured_branch_from_power = {};
+        se_input.measured_voltage = {{.value = 1.0, .variance = 1.0}, {.value = 1.0, .variance = 1.0}};
+
+        auto topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        YBus<symmetric_t> const y_bus{topo_ptr, std::make_shared<MathModelParam<symmetric_t> const>(param)};
+        math_solver::ObservabilityCache cache;
+
+        // the same branches are measured in every scenario, only the global angle sensor moves
+        auto const scenario = [&y_bus, &se_input, &power_measurement](AngleMeasurementType branch_0_angle_type,
+                                                                      AngleMeasurementType branch_2_angle_type) {
+            se_input.measured_branch_from_current = {
+                {.angle_measurement_type = branch_0_angle_type, .measurement = power_measurement},
+                {.angle_measurement_type = branch_2_angle_type, .measurement = power_measurement}};
+            return math_solver::MeasuredValues<symmetric_t>{y_bus.shared_topology(), se_input};
+        };
+
+        // the global angle sensor references the island without voltage phasor sensor
+        auto const anchored_both = scenario(local_angle, global_angle);
+        CHECK_NOTHROW(cache.check(anchored_both, y_bus.math_topology(), y_bus.y_bus_structure()));
+        // the global angle sensor is in the island which is already referenced
+        auto const anchored_one = scenario(global_angle, local_angle);
+        CHECK_THROWS_AS(math_solver::necessary_observability_check(anchored_one, y_bus.math_topology(),
+                                                                   y_bus.y_bus_structure()),
+                        NotObservableError);
+        CHECK_THROWS_AS(cache.check(anchored_one, y_bus.math_topology(), y_bus.y_bus_structure()),
+                        NotObservableError);
+        CHECK_NOTHROW(cache.check(anchored_both, y_bus.math_topology(), y_bus.y_bus_structure()));
+    }
 }
 } // namespace power_grid_model
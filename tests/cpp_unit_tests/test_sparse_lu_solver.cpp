@@ -115,6 +115,7 @@ TEST_CASE("Test Sparse LU solver") {
         SUBCASE("Test calculation") {
             solver.prefactorize_and_solve(data, block_perm, rhs, x);
             check_result(x, x_ref);
+            CHECK(!block_perm[0].no_pivoting);
         }
         SUBCASE("Test (pseudo) singular") {
             data[0](0, 1) = 0.0;
@@ -129,6 +130,45 @@ TEST_CASE("Test Sparse LU solver") {
     }
 }
 
+TEST_CASE("LU solver with diagonally dominant blocks") {
+    // 2*2 matrix with 2*2 blocks, every pivot block is diagonally dominant
+    // [  4 1   1 0          1            9
+    //    1 5   0 1          2           10
+    //    1 0   6 1    *     3     =     18
+    //    0 1   2 7 ]       -1 ]          1 ]
+    auto row_indptr = std::make_shared<IdxVector const>(IdxVector{0, 2, 4});
+    auto col_indices = std::make_shared<IdxVector const>(IdxVector{0, 1, 0, 1});
+    auto diag_lu = std::make_shared<IdxVector const>(IdxVector{0, 3});
+    auto data = std::vector<Tensor>{
+        {{4, 1}, {1, 5}}, // 0, 0
+        {{1, 0}, {0, 1}}, // 0, 1
+        {{1, 0}, {0, 1}}, // 1, 0
+        {{6, 1}, {2, 7}}, // 1, 1
+    };
+    auto const rhs = std::vector<Array>{{9, 10}, {18, 1}};
+    auto const x_ref = std::vector<Array>{{1, 2}, {3, -1}};
+    auto x = std::vector<Array>(2, Array::Zero());
+    SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm(2);
+
+    SparseLUSolver<Tensor, Array, Array> solver{row_indptr, col_indices, diag_lu};
+
+    SUBCASE("No pivoting") {
+        solver.prefactorize_and_solve(data, block_perm, rhs, x);
+        check_result(x, x_ref);
+        CHECK(block_perm[0].no_pivoting);
+        CHECK(block_perm[1].no_pivoting);
+    }
+
+    SUBCASE("Fall back to full pivoting for a non-dominant block") {
+        data[3] = Tensor{{1, 6}, {7, 2}};
+        auto const rhs_non_dominant = std::vector<Array>{{9, 10}, {-2, 21}};
+        solver.prefactorize_and_solve(data, block_perm, rhs_non_dominant, x);
+        check_result(x, x_ref);
+        CHECK(block_perm[0].no_pivoting);
+        CHECK(!block_perm[1].no_pivoting);
+    }
+}
+
 TEST_CASE("LU solver with ill-conditioned system") {
     // test with ill-conditioned matrix if we do not do numerical pivoting
     // 4*4 matrix, or 2*2 with 2*2 blocks
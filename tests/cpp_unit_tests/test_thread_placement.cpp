@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/thread_placement.hpp>
+
+#include <doctest/doctest.h>
+
+#include <thread>
+
+namespace power_grid_model {
+TEST_CASE("Test thread placement") {
+    SUBCASE("Current thread placement") {
+        auto const placement = current_thread_placement();
+        CHECK_FALSE(placement.pinned);
+        CHECK(placement.cpu >= -1);
+        CHECK(placement.numa_node >= -1);
+    }
+
+    SUBCASE("Pin worker thread") {
+        ThreadPlacement pinned_placement{};
+        ThreadPlacement placement_after_work{};
+        std::thread worker{[&pinned_placement, &placement_after_work] {
+            pinned_placement = pin_current_thread(0);
+            placement_after_work = current_thread_placement();
+        }};
+        worker.join();
+
+        if (pinned_placement.pinned) {
+            CHECK(pinned_placement.cpu >= 0);
+            // a pinned thread does not migrate
+            CHECK(placement_after_work.cpu == pinned_placement.cpu);
+            CHECK(placement_after_work.numa_node == pinned_placement.numa_node);
+        } else {
+            // unsupported platform
+            CHECK(pinned_placement.cpu == current_thread_placement().cpu);
+        }
+    }
+
+    SUBCASE("Pin round robin") {
+        Idx const n_cores = static_cast<Idx>(std::thread::hardware_concurrency());
+        if (n_cores > 0) {
+            ThreadPlacement first{};
+            ThreadPlacement wrapped{};
+            std::thread{[&first] { first = pin_current_thread(0); }}.join();
+            std::thread{[&wrapped, n_cores] { wrapped = pin_current_thread(n_cores); }}.join();
+            CHECK(first.pinned == wrapped.pinned);
+            if (first.pinned && wrapped.pinned) {
+                CHECK(first.cpu == wrapped.cpu);
+            }
+        }
+    }
+}
+} // namespace power_grid_model
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/threading.hpp>
+
+#include <doctest/doctest.h>
+
+#include <thread>
+#include <vector>
+
+namespace power_grid_model {
+TEST_CASE("Test threading") {
+    SUBCASE("Number of threads") {
+        auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
+
+        CHECK(get_n_threads(-1, 10) == 1);
+        CHECK(get_n_threads(1, 10) == 1);
+        CHECK(get_n_threads(3, 10) == 3);
+        CHECK(get_n_threads(3, 2) == 2);
+        CHECK(get_n_threads(3, 1) == 1);
+        CHECK(get_n_threads(3, 0) == 1);
+        CHECK(get_n_threads(0, 1000) == (hardware_thread < 2 ? 1 : std::min(hardware_thread, Idx{1000})));
+    }
+
+    SUBCASE("Run in threads") {
+        for (Idx const n_thread : {1, 2, 5}) {
+            CAPTURE(n_thread);
+            std::vector<Idx> calls(n_thread, 0);
+            std::vector<std::thread::id> thread_ids(n_thread);
+            run_in_threads(n_thread, [&calls, &thread_ids](Idx thread_number) {
+                ++calls[thread_number];
+                thread_ids[thread_number] = std::this_thread::get_id();
+            });
+            CHECK(calls == std::vector<Idx>(n_thread, 1));
+            // a single thread function runs in the calling thread
+            CHECK((thread_ids.front() == std::this_thread::get_id()) == (n_thread == 1));
+        }
+    }
+}
+} // namespace power_grid_model
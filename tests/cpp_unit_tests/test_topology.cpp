@@ -299,6 +299,13 @@ TEST_CASE("Test topology") {
         CHECK(topo_comp_coup.load_gen == comp_coup_ref.load_gen);
         CHECK(topo_comp_coup.voltage_sensor == comp_coup_ref.voltage_sensor);
         CHECK(topo_comp_coup.power_sensor == comp_coup_ref.power_sensor);
+        // test flat component coupling
+        CHECK(topo_comp_coup.flat_load_gen.math_model_indptr == IdxVector{0, 2, 3});
+        CHECK(topo_comp_coup.flat_load_gen.component_seq == IdxVector{0, 3, 2});
+        CHECK(topo_comp_coup.flat_load_gen.math_pos == IdxVector{0, 1, 0});
+        CHECK(topo_comp_coup.flat_shunt.math_model_indptr == IdxVector{0, 1, 2});
+        CHECK(topo_comp_coup.flat_shunt.component_seq == IdxVector{0, 1});
+        CHECK(topo_comp_coup.flat_shunt.math_pos == IdxVector{0, 0});
 
         for (size_t i = 0; i < math_topology.size(); i++) {
             auto const& math = *math_topology[i];
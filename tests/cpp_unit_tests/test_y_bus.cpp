@@ -426,6 +426,40 @@ TEST_CASE("Incremental update y-bus") {
 
         ybus.update_admittance_increment(param_update_ptr, math_model_param_incrmt);
         verify_admittance(ybus.admittance(), admittance_sym_2);
+
+        SUBCASE("Progressive update after whole scale update") {
+            YBus<symmetric_t> ybus_reused{topo_ptr, param_sym};
+            ybus_reused.update_admittance(param_sym);
+            verify_admittance(ybus_reused.admittance(), admittance_sym);
+
+            ybus_reused.update_admittance_increment(param_sym_update, math_model_param_incrmt);
+            verify_admittance(ybus_reused.admittance(), admittance_sym_2);
+        }
+    }
+
+    SUBCASE("Test progressive update with changed parameters only") {
+        YBus<symmetric_t> ybus{topo_ptr, param_sym};
+        verify_admittance(ybus.admittance(), admittance_sym);
+
+        // branch 4 and shunt 1 are unchanged
+        MathModelParamIncrement const math_model_param_incrmt{.branch_param_to_change = {0, 1, 2, 3, 5},
+                                                              .shunt_param_to_change = {0}};
+        MathModelParamUpdate<symmetric_t> math_model_param_update;
+        for (Idx const branch : math_model_param_incrmt.branch_param_to_change) {
+            math_model_param_update.branch_param.push_back(param_sym_update.branch_param[branch]);
+        }
+        for (Idx const shunt : math_model_param_incrmt.shunt_param_to_change) {
+            math_model_param_update.shunt_param.push_back(param_sym_update.shunt_param[shunt]);
+        }
+
+        ybus.update_admittance_increment(math_model_param_incrmt, math_model_param_update);
+        verify_admittance(ybus.admittance(), admittance_sym_2);
+
+        auto const& cached_param = ybus.math_model_param();
+        for (size_t branch = 0; branch < param_sym_update.branch_param.size(); ++branch) {
+            CHECK(cached_param.branch_param[branch].value == param_sym_update.branch_param[branch].value);
+        }
+        CHECK(cached_param.shunt_param == param_sym_update.shunt_param);
     }
 }
 
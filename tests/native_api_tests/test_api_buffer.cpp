@@ -2,7 +2,9 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include <power_grid_model_cpp/attribute_view.hpp>
 #include <power_grid_model_cpp/buffer.hpp>
+#include <power_grid_model_cpp/dataset.hpp>
 #include <power_grid_model_cpp/meta_data.hpp>
 #include <power_grid_model_cpp/utils.hpp>
 
@@ -16,7 +18,9 @@
 #include <exception>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace power_grid_model_cpp {
 namespace {
@@ -230,4 +234,284 @@ TEST_CASE("API Buffer") {
     }
 }
 
+TEST_CASE("API Buffer set nan parallel") {
+    // large enough to be divided over multiple threads
+    constexpr Idx size = 500000;
+    constexpr Idx offset = 1000;
+    constexpr Idx sub_size = size - 2 * offset;
+    constexpr ID id{5};
+    constexpr double u_pu{1.0};
+
+    Buffer buffer{PGM_def_sym_output_node, size};
+
+    for (Idx const threading : {-1, 0, 3}) {
+        CAPTURE(threading);
+        // refill the buffer, so that every threading variant has to set the nan values itself
+        buffer.set_value(PGM_def_sym_output_node_id, &id, 0);
+        buffer.set_value(PGM_def_sym_output_node_u_pu, &u_pu, 0);
+        buffer.set_nan_parallel(offset, sub_size, threading);
+
+        std::vector<ID> ids(size);
+        std::vector<double> u_pus(size);
+        buffer.get_value(PGM_def_sym_output_node_id, ids.data(), -1);
+        buffer.get_value(PGM_def_sym_output_node_u_pu, u_pus.data(), -1);
+        for (Idx idx = 0; idx < size; ++idx) {
+            if (idx >= offset && idx < offset + sub_size) {
+                REQUIRE(is_nan(ids[idx]));
+                REQUIRE(is_nan(u_pus[idx]));
+            } else {
+                REQUIRE(ids[idx] == id);
+                REQUIRE(u_pus[idx] == u_pu);
+            }
+        }
+    }
+}
+
+TEST_CASE("API Buffer columns") {
+    constexpr Idx size = 1000; // larger than one block of elements
+    std::vector<MetaAttribute const*> const attributes{PGM_def_input_sym_load_id, PGM_def_input_sym_load_node,
+                                                       PGM_def_input_sym_load_status,
+                                                       PGM_def_input_sym_load_p_specified};
+    std::vector<ID> id(size);
+    std::vector<ID> node(size);
+    std::vector<IntS> status(size);
+    // p_specified is interleaved with a second value
+    std::vector<double> p_specified(2 * size);
+    for (Idx idx = 0; idx < size; ++idx) {
+        id[idx] = static_cast<ID>(idx);
+        node[idx] = static_cast<ID>(size - idx);
+        status[idx] = static_cast<IntS>(idx % 2);
+        p_specified[2 * idx] = static_cast<double>(idx) * 2.0;
+        p_specified[2 * idx + 1] = -1.0;
+    }
+    std::vector<Idx> const strides{-1, sizeof(ID), -1, 2 * sizeof(double)};
+
+    Buffer buffer{PGM_def_input_sym_load, size};
+    buffer.set_nan();
+
+    SUBCASE("Set columns") {
+        buffer.set_columns(attributes, {id.data(), node.data(), status.data(), p_specified.data()}, strides);
+
+        std::vector<ID> ref_id(size);
+        std::vector<ID> ref_node(size);
+        std::vector<IntS> ref_status(size);
+        std::vector<double> ref_p_specified(size);
+        buffer.get_value(PGM_def_input_sym_load_id, ref_id.data(), -1);
+        buffer.get_value(PGM_def_input_sym_load_node, ref_node.data(), -1);
+        buffer.get_value(PGM_def_input_sym_load_status, ref_status.data(), -1);
+        buffer.get_value(PGM_def_input_sym_load_p_specified, ref_p_specified.data(), -1);
+        for (Idx idx = 0; idx < size; ++idx) {
+            REQUIRE(ref_id[idx] == id[idx]);
+            REQUIRE(ref_node[idx] == node[idx]);
+            REQUIRE(ref_status[idx] == status[idx]);
+            REQUIRE(ref_p_specified[idx] == p_specified[2 * idx]);
+        }
+        // other attributes are untouched
+        std::vector<double> q_specified(size);
+        buffer.get_value(PGM_def_input_sym_load_q_specified, q_specified.data(), -1);
+        CHECK(std::ranges::all_of(q_specified, [](double value) { return is_nan(value); }));
+    }
+
+    SUBCASE("Get columns") {
+        buffer.set_value(PGM_def_input_sym_load_id, id.data(), -1);
+        buffer.set_value(PGM_def_input_sym_load_node, node.data(), -1);
+        buffer.set_value(PGM_def_input_sym_load_status, status.data(), -1);
+        buffer.set_value(PGM_def_input_sym_load_p_specified, p_specified.data(), 2 * sizeof(double));
+
+        std::vector<ID> ref_id(size);
+        std::vector<ID> ref_node(size);
+        std::vector<IntS> ref_status(size);
+        std::vector<double> ref_p_specified(2 * size, -1.0);
+        buffer.get_columns(attributes, {ref_id.data(), ref_node.data(), ref_status.data(), ref_p_specified.data()},
+                           strides);
+        CHECK(ref_id == id);
+        CHECK(ref_node == node);
+        CHECK(ref_status == status);
+        CHECK(ref_p_specified == p_specified);
+    }
+
+    SUBCASE("Sub-array") {
+        constexpr Idx offset = 300;
+        constexpr Idx sub_size = 400;
+        buffer.set_columns(attributes, {id.data(), node.data(), status.data(), p_specified.data()}, offset,
+                           sub_size, strides);
+
+        std::vector<ID> ref_id(size);
+        buffer.get_value(PGM_def_input_sym_load_id, ref_id.data(), -1);
+        for (Idx idx = 0; idx < size; ++idx) {
+            if (idx >= offset && idx < offset + sub_size) {
+                REQUIRE(ref_id[idx] == id[idx]);
+            } else {
+                REQUIRE(is_nan(ref_id[idx]));
+            }
+        }
+    }
+}
+
+TEST_CASE("API Attribute view") {
+    constexpr Idx size = 1000;
+
+    SUBCASE("Row-based buffer") {
+        Buffer buffer{PGM_def_input_sym_load, size};
+        buffer.set_nan();
+
+        auto const id = attribute_view<ID>(buffer, PGM_def_input_sym_load_id);
+        auto const status = attribute_view<IntS>(buffer, PGM_def_input_sym_load_status);
+        auto const p_specified = attribute_view<double>(buffer, PGM_def_input_sym_load_p_specified);
+        CHECK(id.size() == size);
+        CHECK(id.stride() == static_cast<Idx>(MetaData::component_size(PGM_def_input_sym_load)));
+        CHECK(!id.is_contiguous());
+        for (Idx idx = 0; idx < size; ++idx) {
+            id[idx] = static_cast<ID>(idx);
+            status[idx] = static_cast<IntS>(idx % 2);
+            p_specified[idx] = static_cast<double>(idx) * 2.0;
+        }
+
+        std::vector<ID> ref_id(size);
+        std::vector<IntS> ref_status(size);
+        std::vector<double> ref_p_specified(size);
+        buffer.get_value(PGM_def_input_sym_load_id, ref_id.data(), -1);
+        buffer.get_value(PGM_def_input_sym_load_status, ref_status.data(), -1);
+        buffer.get_value(PGM_def_input_sym_load_p_specified, ref_p_specified.data(), -1);
+        CHECK(std::ranges::equal(id, ref_id));
+        CHECK(std::ranges::equal(status, ref_status));
+        CHECK(std::ranges::equal(p_specified, ref_p_specified));
+
+        // read-only view of a const buffer, the other attributes are untouched
+        Buffer const& const_buffer = buffer;
+        auto const q_specified = attribute_view<double const>(const_buffer, PGM_def_input_sym_load_q_specified);
+        CHECK(std::ranges::all_of(q_specified, [](double value) { return is_nan(value); }));
+        AttributeView<ID const> const const_id{id};
+        CHECK(const_id[size - 1] == static_cast<ID>(size - 1));
+
+        // the strided iterators work with the standard algorithms
+        std::ranges::sort(id, std::ranges::greater{});
+        CHECK(id[0] == static_cast<ID>(size - 1));
+        CHECK(id[size - 1] == 0);
+        CHECK(*std::ranges::max_element(p_specified) == p_specified[size - 1]);
+        CHECK(p_specified.end() - p_specified.begin() == size);
+
+        CHECK_THROWS_AS(attribute_view<double>(buffer, PGM_def_input_sym_load_id), AttributeTypeMismatch);
+    }
+
+    SUBCASE("Three-phase values") {
+        Buffer buffer{PGM_def_input_asym_load, size};
+        buffer.set_nan();
+        auto const p_specified = attribute_view<std::array<double, 3>>(buffer, PGM_def_input_asym_load_p_specified);
+        p_specified[1] = {1.0, 2.0, 3.0};
+
+        std::vector<std::array<double, 3>> ref_p_specified(size);
+        buffer.get_value(PGM_def_input_asym_load_p_specified, ref_p_specified.data(), -1);
+        CHECK(is_nan(ref_p_specified[0]));
+        CHECK(ref_p_specified[1] == std::array<double, 3>{1.0, 2.0, 3.0});
+    }
+
+    SUBCASE("Columnar buffer") {
+        std::vector<double> column(size, 1.0);
+        auto const view = attribute_view<double>(column.data(), PGM_def_input_sym_load_p_specified, size);
+        CHECK(view.is_contiguous());
+        view[3] = 4.0;
+        CHECK(column[3] == 4.0);
+        std::span<double> const span = view.as_span();
+        CHECK(span.data() == column.data());
+        CHECK(span.size() == column.size());
+        CHECK_THROWS_AS(attribute_view<ID>(column.data(), PGM_def_input_sym_load_p_specified, size),
+                        AttributeTypeMismatch);
+    }
+
+    SUBCASE("Scenario view") {
+        std::vector<ID> column{0, 1, 2, 3, 4, 5};
+        AttributeView<ID> const view{column.data(), static_cast<Idx>(column.size())};
+
+        auto const uniform = scenario_view(view, 1, 3);
+        CHECK(uniform.size() == 3);
+        CHECK(uniform[0] == 3);
+
+        std::vector<Idx> const indptr{0, 1, 1, 6};
+        CHECK(scenario_view(view, 1, -1, indptr).empty());
+        auto const last = scenario_view(view, 2, -1, indptr);
+        CHECK(last.size() == 5);
+        CHECK(last[0] == 1);
+        CHECK(last[4] == 5);
+    }
+
+    SUBCASE("Dataset view") {
+        constexpr Idx batch_size = 2;
+        std::vector<Idx> const sym_load_indptr{0, 1, 3};
+        Buffer sym_load_buffer{PGM_def_update_sym_load, 3};
+        sym_load_buffer.set_nan();
+        std::vector<double> u_ref{1.0, 1.1};
+
+        DatasetMutable dataset{"update", true, batch_size};
+        dataset.add_buffer("sym_load", -1, 3, sym_load_indptr.data(), sym_load_buffer);
+        dataset.add_buffer("source", 1, batch_size, nullptr, nullptr);
+        dataset.add_attribute_buffer("source", "u_ref", u_ref.data());
+
+        // row-based component
+        auto const p_specified = attribute_view<double>(dataset, "sym_load", "p_specified");
+        CHECK(p_specified.size() == 3);
+        CHECK(p_specified.stride() == static_cast<Idx>(MetaData::component_size(PGM_def_update_sym_load)));
+        auto const second_scenario = scenario_view(p_specified, dataset, "sym_load", 1);
+        CHECK(second_scenario.size() == 2);
+        second_scenario[1] = 5.0;
+        std::vector<double> ref_p_specified(3);
+        sym_load_buffer.get_value(PGM_def_update_sym_load_p_specified, ref_p_specified.data(), -1);
+        CHECK(ref_p_specified[2] == 5.0);
+
+        // columnar component
+        auto const source_u_ref = attribute_view<double>(dataset, "source", "u_ref");
+        CHECK(source_u_ref.data() == u_ref.data());
+        CHECK(scenario_view(source_u_ref, dataset, "source", 1)[0] == 1.1);
+
+        // read-only view through a const dataset
+        DatasetConst const const_dataset{dataset};
+        auto const const_p_specified = attribute_view<double const>(const_dataset, "sym_load", "p_specified");
+        CHECK(const_p_specified[2] == 5.0);
+        CHECK(scenario_view(const_p_specified, const_dataset, "sym_load", 0).size() == 1);
+
+        CHECK_THROWS_AS(attribute_view<double>(dataset, "sym_load", "id"), AttributeTypeMismatch);
+        CHECK_THROWS_AS(attribute_view<double>(dataset, "source", "u_ref_angle"), AttributeBufferNotFound);
+    }
+}
+
+TEST_CASE("API Buffer pool") {
+    constexpr Idx size = 100;
+    Handle const handle{};
+
+    SUBCASE("Without pool") {
+        Buffer buffer{PGM_def_sym_output_node, size, handle};
+        CHECK(buffer.get() != nullptr);
+    }
+
+    SUBCASE("Reuse destroyed buffer") {
+        handle.set_buffer_pool_size(1 << 20);
+        RawDataConstPtr first_ptr{};
+        {
+            Buffer buffer{PGM_def_sym_output_node, size, handle};
+            first_ptr = buffer.get();
+        }
+        // a buffer of a similar size gets the same memory
+        {
+            Buffer buffer{PGM_def_sym_output_node, size - 1, handle};
+            CHECK(buffer.get() == first_ptr);
+        }
+        // the pool is kept when the error is cleared
+        handle.clear_error();
+        Buffer buffer{PGM_def_sym_output_node, size, handle};
+        CHECK(buffer.get() == first_ptr);
+    }
+
+    SUBCASE("Buffers outlive the handle") {
+        std::vector<Buffer> buffers;
+        {
+            Handle const temporary_handle{};
+            temporary_handle.set_buffer_pool_size(1 << 20);
+            buffers.emplace_back(PGM_def_sym_output_node, size, temporary_handle);
+            buffers.emplace_back(PGM_def_sym_output_line, size, temporary_handle);
+        }
+        buffers.back().set_nan();
+        buffers.clear();
+    }
+}
+
 } // namespace power_grid_model_cpp
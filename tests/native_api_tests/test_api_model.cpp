@@ -327,6 +327,17 @@ TEST_CASE("API Model") {
         CHECK(batch_node_result_u_angle[3] == doctest::Approx(0.0));
     }
 
+    SUBCASE("Batch power flow with pinned threads") {
+        options.set_threading(2);
+        options.set_thread_affinity(PGM_thread_affinity_pinned);
+        model.calculate(options, batch_output_dataset, batch_update_dataset);
+        node_batch_output.get_value(PGM_def_sym_output_node_u, batch_node_result_u.data(), -1);
+        CHECK(batch_node_result_u[0] == doctest::Approx(40.0));
+        CHECK(batch_node_result_u[1] == doctest::Approx(0.0));
+        CHECK(batch_node_result_u[2] == doctest::Approx(70.0));
+        CHECK(batch_node_result_u[3] == doctest::Approx(0.0));
+    }
+
     SUBCASE("Input error handling") {
         SUBCASE("Construction error") {
             auto const bad_load_id_state_json = R"json({
@@ -435,6 +446,17 @@ TEST_CASE("API Model") {
             check_throws_with(bad_calc_type_lambda, PGM_regular_error, "CalculationType is not implemented for"s);
         }
 
+        SUBCASE("Invalid thread affinity error") {
+            auto const bad_thread_affinity_lambda = [&options, &model, &batch_output_dataset,
+                                                     &batch_update_dataset]() {
+                options.set_threading(2);
+                options.set_thread_affinity(-128);
+                model.calculate(options, batch_output_dataset, batch_update_dataset);
+            };
+            check_throws_with(bad_thread_affinity_lambda, PGM_regular_error,
+                              "get_thread_affinity is not implemented for"s);
+        }
+
         SUBCASE("Invalid tap changing strategy error") {
             auto const bad_tap_strat_lambda = [&options, &model, &single_output_dataset]() {
                 options.set_tap_changing_strategy(-128);
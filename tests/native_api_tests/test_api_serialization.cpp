@@ -2,6 +2,8 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "load_dataset.hpp"
+
 #include "power_grid_model_cpp.hpp"
 
 #include <power_grid_model_c/dataset_definitions.h>
@@ -10,6 +12,8 @@
 #include <nlohmann/json.hpp>
 
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <string>
 #include <vector>
@@ -22,6 +26,57 @@ constexpr char const* json_data =
     R"({"version":"1.0","type":"input","is_batch":false,"attributes":{},"data":{"node":[{"id":5}],"source":[{"id":6},{"id":7}]}})";
 constexpr char const* complete_json_data =
     R"({"version":"1.0","type":"input","is_batch":false,"attributes":{"node": ["id", "u_rated"]},"data":{"node":[[5, 10500]],"source":[{"id":6, "node": 5, "status": 1, "u_ref": 1.0}]}})";
+
+// batch update with a different number of loads per scenario, the loads are a compact list
+nlohmann::json batch_update_json(Idx batch_size) {
+    nlohmann::json json_document = {{"version", "1.0"},
+                                    {"type", "update"},
+                                    {"is_batch", true},
+                                    {"attributes", {{"sym_load", nlohmann::json::array({"id", "p_specified"})}}},
+                                    {"data", nlohmann::json::array()}};
+    for (Idx scenario = 0; scenario != batch_size; ++scenario) {
+        auto sym_load = nlohmann::json::array();
+        for (Idx element = 0; element <= scenario % 3; ++element) {
+            sym_load.push_back(nlohmann::json::array({element + 1, static_cast<double>(scenario * 10 + element)}));
+        }
+        auto source = nlohmann::json::array({{{"id", 10}, {"u_ref", 1.0 + static_cast<double>(scenario) * 0.01}}});
+        json_document["data"].push_back({{"sym_load", sym_load}, {"source", source}});
+    }
+    return json_document;
+}
+
+struct ParsedBatchUpdate {
+    std::vector<Idx> sym_load_indptr;
+    std::vector<ID> sym_load_id;
+    std::vector<double> sym_load_p_specified;
+    std::vector<double> source_u_ref;
+
+    bool operator==(ParsedBatchUpdate const&) const = default;
+};
+
+// parse the loads into columnar buffers and the sources into a row-based buffer
+ParsedBatchUpdate parse_batch_update(std::vector<char> const& msgpack_data, Idx threading) {
+    Deserializer deserializer{msgpack_data, PGM_msgpack};
+    auto& dataset = deserializer.get_dataset();
+    auto const& info = dataset.get_info();
+    Idx const n_sym_load = info.component_total_elements(info.component_idx("sym_load"));
+    Idx const n_source = info.component_total_elements(info.component_idx("source"));
+
+    ParsedBatchUpdate result{.sym_load_indptr = std::vector<Idx>(info.batch_size() + 1),
+                             .sym_load_id = std::vector<ID>(n_sym_load),
+                             .sym_load_p_specified = std::vector<double>(n_sym_load),
+                             .source_u_ref = std::vector<double>(n_source)};
+    Buffer source_buffer{PGM_def_update_source, n_source};
+    dataset.set_buffer("sym_load", result.sym_load_indptr.data(), nullptr);
+    dataset.set_attribute_buffer("sym_load", "id", result.sym_load_id.data());
+    dataset.set_attribute_buffer("sym_load", "p_specified", result.sym_load_p_specified.data());
+    dataset.set_buffer("source", nullptr, source_buffer);
+
+    deserializer.parse_to_buffer(threading);
+
+    source_buffer.get_value(PGM_def_update_source_u_ref, result.source_u_ref.data(), -1);
+    return result;
+}
 } // namespace
 
 TEST_CASE("API Serialization and Deserialization") {
@@ -155,6 +210,24 @@ TEST_CASE("API Serialization and Deserialization") {
 
         check_deserializer(json_deserializer);
         check_deserializer(msgpack_deserializer);
+
+        SUBCASE("From file") {
+            auto const file_path = std::filesystem::temp_directory_path() / "pgm_test_api_deserializer.pgmb";
+            std::ofstream{file_path, std::ios::binary}.write(msgpack_data.data(),
+                                                             static_cast<std::streamsize>(msgpack_data.size()));
+            {
+                auto file_deserializer = Deserializer::from_file(file_path, PGM_msgpack);
+                check_deserializer(file_deserializer);
+            }
+            std::filesystem::remove(file_path);
+
+            try {
+                auto const missing_deserializer = Deserializer::from_file(file_path, PGM_msgpack);
+                FAIL("Expected serialization error not thrown.");
+            } catch (PowerGridSerializationError const& e) {
+                CHECK(e.error_code() == PGM_serialization_error);
+            }
+        }
     }
 
     SUBCASE("Deserializer with columnar data") {
@@ -263,4 +336,159 @@ TEST_CASE("API Serialization and Deserialization with float precision") {
     // check
     CHECK(u_rated_ref[0] == u_rated[0]);
 }
+
+TEST_CASE("API Deserialization in parallel") {
+    constexpr Idx batch_size = 20;
+    std::vector<char> msgpack_data;
+    nlohmann::json::to_msgpack(batch_update_json(batch_size), msgpack_data);
+
+    auto const sequential = parse_batch_update(msgpack_data, -1);
+    REQUIRE(sequential.sym_load_indptr.back() == std::ssize(sequential.sym_load_id));
+    REQUIRE(std::ssize(sequential.source_u_ref) == batch_size);
+    for (Idx scenario = 0; scenario != batch_size; ++scenario) {
+        Idx const begin = sequential.sym_load_indptr[scenario];
+        CHECK(sequential.sym_load_indptr[scenario + 1] - begin == scenario % 3 + 1);
+        CHECK(sequential.sym_load_id[begin] == 1);
+        CHECK(sequential.sym_load_p_specified[begin] == static_cast<double>(scenario * 10));
+        CHECK(sequential.source_u_ref[scenario] == doctest::Approx(1.0 + static_cast<double>(scenario) * 0.01));
+    }
+
+    SUBCASE("Same result for any threading") {
+        for (Idx const threading : {Idx{0}, Idx{1}, Idx{3}, 2 * batch_size}) {
+            CAPTURE(threading);
+            CHECK(parse_batch_update(msgpack_data, threading) == sequential);
+        }
+    }
+
+    SUBCASE("Error in one of the scenarios") {
+        auto json_document = batch_update_json(batch_size);
+        json_document["data"][batch_size - 1]["source"][0]["u_ref"] = "not a number";
+        std::vector<char> invalid_msgpack_data;
+        nlohmann::json::to_msgpack(json_document, invalid_msgpack_data);
+        CHECK_THROWS_AS(parse_batch_update(invalid_msgpack_data, 3), PowerGridSerializationError);
+    }
+}
+
+TEST_CASE("API Dataset conversion") {
+    auto const row_dataset = power_grid_model_cpp_test::load_dataset(complete_json_data);
+
+    auto const columnar_dataset = convert_owning_dataset(row_dataset, true);
+    auto const& columnar_info = columnar_dataset.dataset.get_info();
+    CHECK(columnar_info.n_components() == 2);
+    CHECK(columnar_dataset.storage.buffers.empty());
+    CHECK(!columnar_dataset.storage.attribute_buffers.empty());
+
+    auto const converted_dataset = convert_owning_dataset(columnar_dataset, false, 0);
+    REQUIRE(converted_dataset.storage.buffers.size() == 2);
+
+    ID node_id{};
+    double u_rated{};
+    converted_dataset.storage.buffers[0].get_value(PGM_def_input_node_id, &node_id, -1);
+    converted_dataset.storage.buffers[0].get_value(PGM_def_input_node_u_rated, &u_rated, -1);
+    CHECK(node_id == 5);
+    CHECK(u_rated == 10500.0);
+
+    ID source_node{};
+    double source_u_ref_angle{};
+    converted_dataset.storage.buffers[1].get_value(PGM_def_input_source_node, &source_node, -1);
+    converted_dataset.storage.buffers[1].get_value(PGM_def_input_source_u_ref_angle, &source_u_ref_angle, -1);
+    CHECK(source_node == 5);
+    CHECK(std::isnan(source_u_ref_angle));
+}
+
+TEST_CASE("API Dataset validation") {
+    SUBCASE("Valid dataset") {
+        auto const row_dataset = power_grid_model_cpp_test::load_dataset(complete_json_data);
+        CHECK(ValidationResult{row_dataset.dataset}.is_valid());
+        CHECK(ValidationResult{convert_owning_dataset(row_dataset, true).dataset, 0}.is_valid());
+    }
+
+    SUBCASE("Invalid dataset") {
+        std::vector<ID> const node_id{5, 6};
+        std::vector<double> const node_u_rated{10500.0, -400.0};
+        std::vector<ID> const source_id{6, 7};
+        std::vector<ID> const source_node{5, 8};
+        std::vector<int8_t> const source_status{1, std::numeric_limits<int8_t>::min()};
+        DatasetConst dataset{"input", false, 1};
+        dataset.add_buffer("node", 2, 2, nullptr, nullptr);
+        dataset.add_attribute_buffer("node", "id", node_id.data());
+        dataset.add_attribute_buffer("node", "u_rated", node_u_rated.data());
+        dataset.add_buffer("source", 2, 2, nullptr, nullptr);
+        dataset.add_attribute_buffer("source", "id", source_id.data());
+        dataset.add_attribute_buffer("source", "node", source_node.data());
+        dataset.add_attribute_buffer("source", "status", source_status.data());
+
+        ValidationResult const result{dataset, 2};
+        CHECK(!result.is_valid());
+        REQUIRE(result.n_errors() == 5);
+        auto const check_error = [&result](Idx error_idx, Idx error_type, std::string const& component,
+                                           std::string const& attribute, std::vector<Idx> const& elements) {
+            CHECK(result.error_type(error_idx) == error_type);
+            CHECK(result.component_name(error_idx) == component);
+            CHECK(result.attribute_name(error_idx) == attribute);
+            CHECK(result.elements(error_idx) == elements);
+        };
+        check_error(0, PGM_validation_not_unique, "node", "id", {1});
+        check_error(1, PGM_validation_out_of_range, "node", "u_rated", {1});
+        check_error(2, PGM_validation_not_unique, "source", "id", {0});
+        check_error(3, PGM_validation_invalid_reference, "source", "node", {1});
+        check_error(4, PGM_validation_missing_value, "source", "status", {1});
+    }
+
+    SUBCASE("Not an input dataset") {
+        DatasetConst dataset{"update", false, 1};
+        CHECK_THROWS_AS((ValidationResult{dataset}), PowerGridRegularError);
+    }
+}
+
+TEST_CASE("API Arrow IPC") {
+    std::vector<ID> const node_id{5, 6, 7};
+    std::vector<double> const node_u_rated{10500.0, std::numeric_limits<double>::quiet_NaN(), 400.0};
+    DatasetConst dataset{"input", false, 1};
+    dataset.add_buffer("node", 3, 3, nullptr, nullptr);
+    dataset.add_attribute_buffer("node", "id", node_id.data());
+    dataset.add_attribute_buffer("node", "u_rated", node_u_rated.data());
+
+    for (Idx const arrow_ipc_format : {PGM_arrow_stream, PGM_arrow_file}) {
+        CAPTURE(arrow_ipc_format);
+
+        ArrowExporter exporter{dataset, arrow_ipc_format};
+        std::vector<char> data;
+        exporter.get_component("node", data);
+        CHECK(!data.empty());
+
+        ArrowImporter importer;
+        DatasetConst imported{"input", false, 1};
+        importer.add_component(imported, "node", data);
+        auto const& info = imported.get_info();
+        REQUIRE(info.n_components() == 1);
+        CHECK(info.component_name(0) == "node");
+        CHECK(info.component_elements_per_scenario(0) == 3);
+        CHECK(info.component_total_elements(0) == 3);
+
+        Buffer node_buffer{PGM_def_input_node, 3};
+        DatasetMutable row_based{"input", false, 1};
+        row_based.add_buffer("node", 3, 3, nullptr, node_buffer);
+        imported.convert_to(row_based);
+        std::vector<ID> imported_id(3);
+        std::vector<double> imported_u_rated(3);
+        node_buffer.get_value(PGM_def_input_node_id, imported_id.data(), -1);
+        node_buffer.get_value(PGM_def_input_node_u_rated, imported_u_rated.data(), -1);
+        CHECK(imported_id == node_id);
+        CHECK(imported_u_rated[0] == 10500.0);
+        CHECK(std::isnan(imported_u_rated[1]));
+        CHECK(imported_u_rated[2] == 400.0);
+    }
+
+    SUBCASE("Invalid Arrow IPC format") {
+        CHECK_THROWS_AS((ArrowExporter{dataset, -1}), PowerGridSerializationError);
+    }
+
+    SUBCASE("Invalid Arrow IPC data") {
+        ArrowImporter importer;
+        DatasetConst imported{"input", false, 1};
+        std::vector<char> const data{'n', 'o', 'd', 'e'};
+        CHECK_THROWS_AS(importer.add_component(imported, "node", data), PowerGridSerializationError);
+    }
+}
 } // namespace power_grid_model_cpp